@@ -10,23 +10,48 @@
 #ifndef I64_C89_H
 #define I64_C89_H
 
-#include <assert.h>
-	/* TODO: remove all assertions (we only use them
-		for debugging tests, not the actual tests)
-		and remove this include. */
-
-#include <stdio.h>
-
-#include <string.h>
-	/* needed for strncmp */
 #include <stdlib.h>
 	/* needed for integer division */
-#include <math.h>
-	/* math.h is needed solely for functions
-		used to test assertions on doubles --
-		eventually remove the assertions and this */
+#include <stddef.h>
+	/* needed for size_t */
+#ifndef I64_ASSUME_IEEE754
+	#include <math.h>
+		/* needed solely for frexp, ldexp and floor
+			in i64_fromDouble */
+#endif
+
+/*
+	ASSERTIONS
+	----------
+	I64_ASSERT(cond) checks caller errors, such as
+	dividing by zero; every such call has a defined
+	fallback behaviour, so the checks can be dropped
+	freely. Choose one of:
+	
+	- nothing (the default): use the standard assert,
+		itself dropped when NDEBUG is defined;
+	- I64_NO_ASSERT: compile every check to nothing,
+		without including assert.h;
+	- I64_ASSERT_HANDLER: call
+		I64_ASSERT_HANDLER(expr, file, line) on failure,
+		where 'expr' is the failed condition as a string.
+	
+	Defining I64_ASSERT yourself overrides all of these.
+*/
+#ifndef I64_ASSERT
+	#if defined(I64_NO_ASSERT)
+		#define I64_ASSERT(cond) ((void)0)
+	#elif defined(I64_ASSERT_HANDLER)
+		#define I64_ASSERT(cond) \
+			((cond) ? (void)0 : \
+				(void)I64_ASSERT_HANDLER(#cond, __FILE__, __LINE__))
+	#else
+		#include <assert.h>
+		#define I64_ASSERT(cond) assert(cond)
+	#endif
+#endif
 
-#define SHR32F0(n, m) (((u32)n) >> m)
+#define SHR32F0(n, m) (((u32)(n)) >> (m))
 	/* "Shift Right a i32, and
  	and Fill with 0s. " */
 	
@@ -44,6 +69,163 @@
 typedef int i32;
 typedef unsigned int u32;
 
+/*
+	NATIVE BACKEND
+	--------------
+	If the compiler has a native 64-bit integer type
+	('long long' in C99, '__int64' in MSVC), the arithmetic,
+	comparisons, shifts and division below use it instead of
+	16-bit chunks. The i64 struct and every function signature
+	stay the same either way.
+	
+	Define I64_USE_NATIVE to force the native backend, or
+	I64_NO_NATIVE to force the pure C89 one.
+*/
+#if !defined(I64_USE_NATIVE) && !defined(I64_NO_NATIVE)
+	#if defined(_MSC_VER) \
+			|| (defined(__STDC_VERSION__) && __STDC_VERSION__ >= 199901L)
+		#define I64_USE_NATIVE
+	#endif
+#endif
+
+#ifdef I64_USE_NATIVE
+	#ifdef _MSC_VER
+		typedef __int64 i64_native_;
+		typedef unsigned __int64 u64_native_;
+	#else
+		typedef long long i64_native_;
+		typedef unsigned long long u64_native_;
+	#endif
+#endif
+
+/*
+	WORD-CARRY ARITHMETIC
+	---------------------
+	Without a native 64-bit type, i64_add, i64_subtract and
+	i64_negate follow goog.math.Long and carry between 16-bit
+	chunks -- a limit of JS numbers, not of C. Define
+	I64_USE_WORD_CARRY to instead operate on whole 32-bit
+	words as u32s, detecting the carry from the low word by
+	unsigned wraparound (sum < addend). Results are identical.
+*/
+
+/*
+	'restrict' qualifies the pointers of the array operations
+	where the compiler understands it; C89 has no such keyword.
+*/
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 199901L
+	#define I64_RESTRICT restrict
+#elif defined(_MSC_VER) || defined(__GNUC__)
+	#define I64_RESTRICT __restrict
+#else
+	#define I64_RESTRICT
+#endif
+
+/*
+	LINKAGE
+	-------
+	Every function is declared with I64_API. By default that
+	is 'static', made inline where the compiler has a keyword
+	for it, so the header can be included from any number of
+	translation units and calls to its small functions
+	(i64_fromBits, i64_add, ...) inline into plain register
+	moves.
+	
+	To build the library out-of-line instead, define
+	I64_EXTERN wherever the header is included, and
+	I64_IMPLEMENTATION in exactly one source file, before it
+	includes i64_c89.h or i64_c89_simd.h:
+	
+		#define I64_IMPLEMENTATION
+		#include "i64_c89.h"
+	
+	That file then holds the only definitions, with external
+	linkage; elsewhere the header only declares them.
+	I64_IMPLEMENTATION implies I64_EXTERN. I64_API may also
+	be defined beforehand, e.g. to export the functions from
+	a DLL.
+	
+	In the default mode, the mutable state -- the trace hook
+	and the SIMD dispatch table -- is per translation unit.
+*/
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 199901L
+	#define I64_INLINE_ inline
+#elif defined(__GNUC__)
+	#define I64_INLINE_ __inline__
+#elif defined(_MSC_VER)
+	#define I64_INLINE_ __inline
+#else
+	#define I64_INLINE_
+#endif
+
+#if defined(I64_IMPLEMENTATION) && !defined(I64_EXTERN)
+	#define I64_EXTERN
+#endif
+
+#ifdef I64_EXTERN
+	#ifndef I64_API
+		#define I64_API
+	#endif
+	#define I64_GLOBAL_
+		/* storage for mutable state */
+#else
+	#ifndef I64_API
+		#define I64_API static I64_INLINE_
+	#endif
+	#define I64_GLOBAL_ static
+#endif
+
+#if !defined(I64_EXTERN) || defined(I64_IMPLEMENTATION)
+	#define I64_DEFINE_
+		/* this translation unit holds the definitions */
+#endif
+
+/*
+	TRACING
+	-------
+	The library never writes output of its own. Diagnostics
+	go through I64_TRACE, which takes its printf-style
+	arguments in an extra pair of parentheses (C89 has no
+	variadic macros):
+	
+		I64_TRACE(("value: %d\n", x));
+	
+	By default it compiles to nothing. Define
+	I64_ENABLE_TRACE to route it to the hook set with
+	i64_setTraceHook, or to stdout if none is set; the
+	i64_debugPrint functions exist only then.
+*/
+#ifdef I64_ENABLE_TRACE
+	#include <stdarg.h>
+	#include <stdio.h>
+
+typedef void (*i64_traceHook)(const char *format, va_list args);
+
+#ifdef I64_DEFINE_
+I64_GLOBAL_ i64_traceHook i64_traceHook_ = NULL;
+
+/* Sets the trace hook; NULL restores printing to stdout. */
+I64_API void i64_setTraceHook(i64_traceHook hook) {
+	i64_traceHook_ = hook;
+}
+
+I64_API void i64_trace_(const char *format, ...) {
+	va_list args;
+	va_start(args, format);
+	if(i64_traceHook_ != NULL) {
+		i64_traceHook_(format, args);
+	} else {
+		vprintf(format, args);
+	}
+	va_end(args);
+}
+#endif
+
+	#define I64_TRACE(args) (i64_trace_ args)
+#else
+	#define I64_TRACE(args) ((void)0)
+#endif
+
 /*
 	BASE DEFINITIONS
 	================
@@ -54,34 +236,57 @@ typedef struct {
 	i32 high_;
 } i64;
 
-void i64_debugPrint(i64 this) {
-	printf("0x%.8x :: 0x%.8x", this.high_, this.low_);
+#ifdef I64_ENABLE_TRACE
+#ifdef I64_DEFINE_
+I64_API void i64_debugPrint(i64 this) {
+	I64_TRACE(("0x%.8x :: 0x%.8x", this.high_, this.low_));
 }
 
-void i64_debugPrintDecimal(i64 this) {
+I64_API void i64_debugPrintDecimal(i64 this) {
 	i32 neg_p = this.high_ & 0x80000000;
 	if(neg_p != 0) {
-		printf("-((%u * 2^32) + %u + 1)", ~this.high_ , ~this.low_);
+		I64_TRACE(("-((%u * 2^32) + %u + 1)", ~this.high_ , ~this.low_));
 	} else {
-		printf("((%u * 2^32) + %u)", this.high_, this.low_);
+		I64_TRACE(("((%u * 2^32) + %u)", this.high_, this.low_));
 		
 	}
 }
+#endif
+
+#define i64_debugPrintNewlining(this) \
+	(I64_TRACE(("\n")), i64_debugPrint(this), I64_TRACE(("\n")))
+#endif
 
 #define i64_isEqual(this, other) \
 	((this.low_ == other.low_) && \
 		(this.high_ == other.high_))
-
-#define i64_debugPrintNewlining(this) \
-	(printf("\n"), i64_debugPrint(this), printf("\n"))
 	
 	
-i64 i64_fromBits(i32 low, i32 high) {
+#ifdef I64_DEFINE_
+I64_API i64 i64_fromBits(i32 low, i32 high) {
 	i64 ret;
 	ret.low_ = low;
 	ret.high_ = high;
 	return ret;
 }
+#endif
+
+#ifdef I64_USE_NATIVE
+/*
+	Moving between i64 and the native type. We do arithmetic
+	on the unsigned type, where overflow wraps as it does
+	for i64.
+*/
+#define I64_TO_U64_(this) \
+	((((u64_native_)(u32)(this).high_) << 32) | (u32)(this).low_)
+#define I64_TO_S64_(this) ((i64_native_)I64_TO_U64_(this))
+
+#ifdef I64_DEFINE_
+I64_API i64 i64_fromU64_(u64_native_ value) {
+	return i64_fromBits((i32)(u32)value, (i32)(u32)(value >> 32));
+}
+#endif
+#endif
 
 #define i64_getHighBits(this) ((i32)this.high_)
 #define i64_getLowBits(this) ((i32)this.low_)
@@ -110,19 +315,48 @@ i64 i64_fromBits(i32 low, i32 high) {
 			-(2^62) <= x (2^62 - 1).
 	*/
 
+/*
+	Constant initializers, for static data and tables:
+	I64_INIT(high, low) is the i64 with the given 32-bit
+	halves. I64_C(value) sign-extends an integer constant
+	read as an i32, and I64_UC(value) zero-extends one read
+	as a u32, so I64_C(0xFFFFFFFF) is -1 but I64_UC(0xFFFFFFFF)
+	is 2^32 - 1. (Note that C has no negative literals:
+	-0x80000000 is an unsigned int, so only I64_C reads it
+	as -2^31.) All are brace-enclosed, so they can only
+	initialize (not be assigned):
+	
+		static const i64 I64_POWERS_OF_SIXTEEN[] = {
+			I64_C(1), I64_C(0x10), ... I64_INIT(0x10000000, 0)
+		};
+	
+	A table of them is ordinary read-only data, with nothing
+	to compute at startup.
+*/
+#define I64_INIT(high, low) { (i32)(low), (i32)(high) }
+#define I64_C(value) { (i32)(value), -((i32)(value) < 0) }
+#define I64_UC(value) { (i32)(u32)(value), 0 }
+
+static const i64 I64_ZERO = I64_INIT(0, 0);
+static const i64 I64_ONE = I64_INIT(0, 1);
+static const i64 I64_NEG_ONE = I64_INIT(0xFFFFFFFF, 0xFFFFFFFF);
+static const i64 I64_MIN = I64_INIT(0x80000000, 0);
+static const i64 I64_MAX = I64_INIT(0x7FFFFFFF, 0xFFFFFFFF);
+
+#ifdef I64_DEFINE_
 /*
 	Get the smallest _in magnitude_ i64.
 */
-i64 i64_getMinValue() {
-	return i64_fromBits(0, 0x80000000);
+I64_API i64 i64_getMinValue() {
+	return I64_MIN;
 }
 
-i64 i64_getMaxValue() {
-	return i64_fromBits(0xFFFFFFFF, 0x7FFFFFFF);
+I64_API i64 i64_getMaxValue() {
+	return I64_MAX;
 }
 
-i64 i64_getZero() {
-	return i64_fromBits(0, 0);
+I64_API i64 i64_getZero() {
+	return I64_ZERO;
 }
 
 /*
@@ -130,12 +364,12 @@ i64 i64_getZero() {
 	illustrate little-ending byte ordering used
 */
 
-i64 i64_getOne() {
-	return i64_fromBits(1, 0);
+I64_API i64 i64_getOne() {
+	return I64_ONE;
 }
 
-i64 i64_getNegOne() {
-	return i64_fromBits(-1, -1);
+I64_API i64 i64_getNegOne() {
+	return I64_NEG_ONE;
 }
 	
 
@@ -144,58 +378,91 @@ i64 i64_getNegOne() {
 	===========
 */
 
-int i64_isZero(i64 this) {
+I64_API int i64_isZero(i64 this) {
 	return this.low_ == 0 && this.high_ == 0;
 }
 
-int i64_isNegative(i64 this) {
+I64_API int i64_isNegative(i64 this) {
 	return this.high_ < 0;
 }
 
-int i64_isOdd(i64 this) {
+I64_API int i64_isOdd(i64 this) {
 	return (this.low_ & 1) == 1;
 }
 
+/*
+	All of the comparisons below are branch-free: the
+	signed comparison of the high words and the unsigned
+	comparison of the low words are both computed, and
+	combined with arithmetic rather than selected between
+	with a branch (which mispredicts on unsorted data).
+*/
+
 /*
 	Compares two 64s a, b and returns one of three results:
 	- 0 if a == b,
 	- 1 if a > b;
 	- (-1) if a < b.
 */
-int i64_compare(i64 this, i64 other) {
-	if (this.high_ == other.high_) {
-		if (this.low_ == other.low_) {
-			return 0;
-		}
-		return i64_getLowBitsUnsigned(this) >
-			i64_getLowBitsUnsigned(other) ? 1 : -1;
-    }
-    return this.high_ > other.high_ ? 1 : -1;
+I64_API int i64_compare(i64 this, i64 other) {
+#ifdef I64_USE_NATIVE
+	i64_native_ a = I64_TO_S64_(this), b = I64_TO_S64_(other);
+	return (a > b) - (a < b);
+#else
+	int highCmp = (this.high_ > other.high_) - (this.high_ < other.high_);
+	int lowCmp = (i64_getLowBitsUnsigned(this) > i64_getLowBitsUnsigned(other))
+		- (i64_getLowBitsUnsigned(this) < i64_getLowBitsUnsigned(other));
+	return highCmp | (lowCmp & -(highCmp == 0));
+		/* the high words decide, unless they are equal */
+#endif
 }
 
+/*
+	As i64_compare, but treating both as unsigned
+	64-bit integers.
+*/
+I64_API int i64_compareUnsigned(i64 this, i64 other) {
+	int highCmp = ((u32)this.high_ > (u32)other.high_)
+		- ((u32)this.high_ < (u32)other.high_);
+	int lowCmp = (i64_getLowBitsUnsigned(this) > i64_getLowBitsUnsigned(other))
+		- (i64_getLowBitsUnsigned(this) < i64_getLowBitsUnsigned(other));
+	return highCmp | (lowCmp & -(highCmp == 0));
+}
 
-int i64_equals(i64 this, i64 other) {
-	return (this.low_ == other.low_) && (this.high_ == other.high_);
+I64_API int i64_equals(i64 this, i64 other) {
+	return (this.low_ == other.low_) & (this.high_ == other.high_);
 }
 
-int i64_notEquals(i64 this, i64 other) {
+I64_API int i64_notEquals(i64 this, i64 other) {
 	return !i64_equals(this, other);
 }
 
-int i64_lessThan(i64 this, i64 other) {
-	return i64_compare(this, other) < 0;
+I64_API int i64_lessThan(i64 this, i64 other) {
+#ifdef I64_USE_NATIVE
+	return I64_TO_S64_(this) < I64_TO_S64_(other);
+#else
+	return (this.high_ < other.high_)
+		| ((this.high_ == other.high_)
+			& (i64_getLowBitsUnsigned(this) < i64_getLowBitsUnsigned(other)));
+#endif
 }
 
-int i64_lessThanOrEqual(i64 this, i64 other) {
-	return i64_compare(this, other) <= 0;
+I64_API int i64_lessThanOrEqual(i64 this, i64 other) {
+#ifdef I64_USE_NATIVE
+	return I64_TO_S64_(this) <= I64_TO_S64_(other);
+#else
+	return (this.high_ < other.high_)
+		| ((this.high_ == other.high_)
+			& (i64_getLowBitsUnsigned(this) <= i64_getLowBitsUnsigned(other)));
+#endif
 }
 
-int i64_greaterThan(i64 this, i64 other) {
-	return i64_compare(this, other) > 0;
+I64_API int i64_greaterThan(i64 this, i64 other) {
+	return i64_lessThan(other, this);
 }
 
-int i64_greaterThanOrEqual(i64 this, i64 other) {
-	return i64_compare(this, other) >= 0;
+I64_API int i64_greaterThanOrEqual(i64 this, i64 other) {
+	return i64_lessThanOrEqual(other, this);
 }
 
 /*
@@ -204,8 +471,15 @@ int i64_greaterThanOrEqual(i64 this, i64 other) {
 	(division is defined at the very end)
 */
 
-i64 i64_negate(i64 this) {
-	i64 ret;
+I64_API i64 i64_negate(i64 this) {
+#if defined(I64_USE_NATIVE)
+	return i64_fromU64_(0 - I64_TO_U64_(this));
+#elif defined(I64_USE_WORD_CARRY)
+	u32 negLow = 0 - (u32)this.low_;
+	return i64_fromBits(negLow,
+		0 - (u32)this.high_ - (negLow != 0));
+		/* borrow from the high word unless the low word is 0 */
+#else
 	i32 negLow, overflowFromLow, negHigh;
 
 	negLow = (~this.low_ + 1) | 0;
@@ -220,9 +494,17 @@ i64 i64_negate(i64 this) {
 	negHigh = (~this.high_ + overflowFromLow) | 0;
 		/*  again, 2s-complement negation */
 	return i64_fromBits(negLow, negHigh);
+#endif
 }
 
-i64 i64_add(i64 this, i64 other) {
+I64_API i64 i64_add(i64 this, i64 other) {
+#if defined(I64_USE_NATIVE)
+	return i64_fromU64_(I64_TO_U64_(this) + I64_TO_U64_(other));
+#elif defined(I64_USE_WORD_CARRY)
+	u32 low = (u32)this.low_ + (u32)other.low_;
+	return i64_fromBits(low,
+		(u32)this.high_ + (u32)other.high_ + (low < (u32)this.low_));
+#else
 	/* although I've stated above that all of these
 		algorithms are essentially ported verbatim
 		from Google's goog.math.Long, I should re-emphasize
@@ -266,96 +548,70 @@ i64 i64_add(i64 this, i64 other) {
 		(c16 << 16) | c00,
 		(c48 << 16) | c32
 	);
+#endif
 }
 
-i64 i64_subtract(i64 this, i64 other) {
+I64_API i64 i64_subtract(i64 this, i64 other) {
+#if defined(I64_USE_NATIVE)
+	return i64_fromU64_(I64_TO_U64_(this) - I64_TO_U64_(other));
+#elif defined(I64_USE_WORD_CARRY)
+	return i64_fromBits((u32)this.low_ - (u32)other.low_,
+		(u32)this.high_ - (u32)other.high_
+			- ((u32)this.low_ < (u32)other.low_));
+#else
 	return i64_add(this, i64_negate(other));
+#endif
 }
 
-i64 i64_multiply(i64 this, i64 other) {
-	/* We do long multiplication: adding (with extended width)
-		successive (sets of consecutive) digits.
-		In particular, we split in 4 chunks of 16 bits,
-		as with i64_add, but do the repeated arithmetic
-		with 32-bit integers to handle overflow. */
-		
-	i32 a48 = SHR32F0(this.high_, 16);
-    i32 a32 = this.high_ & 0xFFFF;
-    i32 a16 = SHR32F0(this.low_, 16);
-    i32 a00 = this.low_ & 0xFFFF;
-
-    i32 b48 = SHR32F0(other.high_, 16);
-    i32 b32 = other.high_ & 0xFFFF;
-    i32 b16 = SHR32F0(other.low_, 16);
-    i32 b00 = other.low_ & 0xFFFF;
-
-    i32 c48 = 0, c32 = 0, c16 = 0, c00 = 0;
-	
-	if(i64_isZero(this)) {
-		return this;
-	}
-	if(i64_isZero(other)) {
-		return other;
-	}
-	
-	/* Okay - now start the long mulitplication. */
-	c00 += a00 * b00;
-    c16 += SHR32F0(c00, 16);
-    c00 &= 0xFFFF;
-    c16 += a16 * b00;
-	
-    c32 += SHR32F0(c16, 16);
-    c16 &= 0xFFFF;
-    c16 += a00 * b16;
-    c32 += SHR32F0(c16, 16);
-    c16 &= 0xFFFF;
-    c32 += a32 * b00;
-	
-    c48 += SHR32F0(c32, 16);
-    c32 &= 0xFFFF;
-    c32 += a16 * b16;
-    c48 += SHR32F0(c32, 16);
-    c32 &= 0xFFFF;
-    c32 += a00 * b32;
-    c48 += SHR32F0(c32, 16);
-    c32 &= 0xFFFF;
-    c48 += a48 * b00 + a32 * b16 + a16 * b32 + a00 * b48;
-    c48 &= 0xFFFF;
-	
-    return i64_fromBits(
-		(c16 << 16) | c00,
-		(c48 << 16) | c32
+/*
+	The full 64-bit product of two u32s. We split each into
+	16-bit halves, as i64_add does, but keep the four partial
+	products in u32s, where they cannot overflow.
+*/
+I64_API i64 i64_multiplyU32_(u32 a, u32 b) {
+	u32 a00 = a & 0xFFFF, a16 = a >> 16;
+	u32 b00 = b & 0xFFFF, b16 = b >> 16;
+	u32 p00 = a00 * b00, p16 = a16 * b00, p16b = a00 * b16;
+	u32 mid;
+
+	mid = (p00 >> 16) + (p16 & 0xFFFF) + (p16b & 0xFFFF);
+		/* at most 3 * (2^16 - 1): no overflow */
+	return i64_fromBits(
+		(mid << 16) | (p00 & 0xFFFF),
+		a16 * b16 + (p16 >> 16) + (p16b >> 16) + (mid >> 16)
 	);
 }
 
-/* Division. 
-   TODO: Currently, we bootstrap from 'double' arithmetic.
-   This is not ideal, since we use sprintf to convert double -> i64.
-	Ideally, we would use Knuth's Algorithm D (cf. Hacker's
-	Delight, 9-2.) */
-i64 i64_fromDouble(double value);
-double i64_toDouble(i64 value);
-	/* TODO: these forward declarations are only temporary
-		while we bootstrap i64 division from double division. */
-i64 i64_DivMod(i64 this, i64 other, i64* rem) {
-	double thisD, otherD, remD, resD;
+I64_API i64 i64_multiply(i64 this, i64 other) {
+#ifdef I64_USE_NATIVE
+	return i64_fromU64_(I64_TO_U64_(this) * I64_TO_U64_(other));
+#else
+	/* Writing this = 2^32 * thisHigh + thisLow (and the same
+		for other), the product modulo 2^64 is
+			thisLow * otherLow
+			+ 2^32 * (thisHigh * otherLow + thisLow * otherHigh);
+		the thisHigh * otherHigh term lies wholly above bit 64.
+		Only the first product needs all 64 bits; the two
+		cross products only need their low 32, which is just
+		u32 multiplication. */
+	i64 ret = i64_multiplyU32_(this.low_, other.low_);
+
+	if((u32)this.high_ + 1 <= 1 && (u32)other.high_ + 1 <= 1) {
+		/* Early out when both high words are all 0s or all
+			1s, as for sign-extended 32-bit values: each cross
+			product is then 0 or minus a low word, and needs
+			no multiplication. */
+		ret.high_ = (u32)ret.high_
+			- ((u32)this.high_ & (u32)other.low_)
+			- ((u32)other.high_ & (u32)this.low_);
+		return ret;
+	}
 
-	/* 'this' and 'other' are both two words.
-		Perform division in 'double' land. */
-	thisD = i64_toDouble(this);
-	otherD = i64_toDouble(other);
-	
-	remD = fmod(thisD, otherD);
-	/* at this point, remD should be an integer; */
-	assert(floor(remD) == remD);
-	*rem = i64_fromDouble(remD);
-	
-	resD = floor(thisD / otherD);	
-	resD = (resD < 0) ? ceil(resD) : floor(resD);
-	/* at this point, resD should be an integer; */
-	assert(floor(resD) == resD);
-	
-	return i64_fromDouble(resD);
+	ret.high_ = (u32)ret.high_
+		+ (u32)this.high_ * (u32)other.low_
+		+ (u32)this.low_ * (u32)other.high_;
+	return ret;
+#endif
 }
 
 /*
@@ -369,7 +625,7 @@ i64 i64_DivMod(i64 this, i64 other, i64* rem) {
 */
 
 
-i64 i64_fromInt(i32 intValue) {
+I64_API i64 i64_fromInt(i32 intValue) {
 	return i64_fromBits(intValue,
 				intValue < 0 ? -1 : 0); 
 }
@@ -378,150 +634,122 @@ i64 i64_fromInt(i32 intValue) {
 	Assuming the value represented by 'this'
 	fits into an i32, return it.
 */
-i32 i64_toInt(i64 this) {
+I64_API i32 i64_toInt(i64 this) {
 	return this.low_;
 }
 
 /*
-	Returns an i64 representing an integer double
-	- the case where an easy conversion works as
-	we will explain below.
+	Returns an i64 representing a double.
 	
 	The C equivalent of goog.math.Long's
 	Long.fromNumber() routine, recalling that ES6
 	Numbers are just doubles.
 	
-	'Value' should be integral; otherwise, UB.
+	Any fractional part is truncated (towards zero).
 	
 	Special cases: 
 	NaN => 0; 
-	-/+ inf => min/max value.
-	
-	WARNING: as currently implemented,
-		this operation is relatively expensive in
-		terms of both time and space:
-		- it allocates a char[100]
-		on the stack,
-		- uses sprintf (with a sentintel check);
-		- does a lot of i64 arithmetic (to the
-		order of log_10(n) iterations, but with
-		a single scratch i64.);
-*/
-
-i64 i64_fromDouble(double value) {
-	char intermediate[50];
-	i64 result;
-	int idx;
-	int sign = 1;
-	/* PROLOG:
-		We are using 'sprintf'. So
-		add a canary value to 'value'. If
-		this has been overwritten by the
-		end of the routine, we're fucked. */
-	intermediate[49] = 0;
-		
+	-/+ inf, and finite values out of range => min/max value.
 	
-	/* CHECK ASSUMPTIONS: value is an integer */
-	printf("i64_toDouble xx: %a == %a = %d\n", value, floor(value), value == floor(value));
-	assert(value != value || value == floor(value));
-		/* first conditional checks NAN;
-			ceil would work as well */
-		
-	/* We want to split the top and bottom
-		words of a double, without
-		loss of precision and portably (e.g.
-		without directly manipulating representation
-		of doubles). The semantically easiest way
-		of doing so is by representing doubles
-		as string values. */
-	sprintf(intermediate, "%#F", value);
-		/* obtain output of form
-			[-]xxxx.[yyy]
-			(note the decimal point is not optional.)
-			NANs and INFs are handled portably by %F
-				(vs. %f) */
-	assert(intermediate[49] == 0);
-		/* CHECK: is the string buffer sentinel stil there? 
-			Check the canary on our intermediate string
-			buffer to make sure 'sprintf' fuckery
-			hasn't occurred. If it has, crash FAST. */
-			
+	We split the double into an integral 53-bit mantissa
+	and a binary exponent, then place the mantissa with
+	a single shift. By default we do so portably with
+	frexp and ldexp; defining I64_ASSUME_IEEE754 instead
+	reads the bits of the double directly.
+*/
+
+I64_API i64 i64_shiftLeft(i64 this, i32 numBits);
+I64_API i64 i64_shiftRightUnsigned(i64 this, i32 numBits);
+	/* Forward refs. -- the shifts are defined
+		with the other bitwise operations below. */
+
+I64_API i64 i64_fromDouble(double value) {
+	i64 mantissa;
+	int exponent;
+#ifdef I64_ASSUME_IEEE754
+	union {
+		double d;
+		u32 w[2];
+	} bits, one;
+	int hi;
+	u32 highWord;
+#else
+	double frac, top;
+#endif
+
 	/* Pathological cases for 'value'. */
-	if(strncmp("NAN", intermediate, 3) == 0) {
-		return i64_getZero();
-	} else if(strncmp("-INF", intermediate, 4) == 0) {
-		return i64_getMinValue();
-	} else if(strncmp("INF", intermediate, 3) == 0) {
-		return i64_getMaxValue();
+	if(value != value) {
+		return I64_ZERO;
+	} else if(value <= -TWO_PWR_63_DBL_) {
+		return I64_MIN;
+	} else if(value >= TWO_PWR_63_DBL_) {
+		return I64_MAX;
+	} else if(value < 0) {
+		return i64_negate(i64_fromDouble(-value));
+	} else if(value < 1) {
+		return I64_ZERO;
 	}
-		
-	/* Initialize string parse state. */
-	idx = 0;
-	result = i64_getZero();
-	
-	/* Determine sign of resulting i64. */
-	if(intermediate[0] == '-') {
-		sign = -1;
-		idx++;
-	}
-	
-	/* Shift and add digits until we reach a '0.' */
-	for(; (idx < 49) && (intermediate[idx] != '.'); idx++) {
-		printf("fromDouble iteration %d: digit %c, result_in = ", idx, intermediate[idx]);
-		i64_debugPrintDecimal(result); printf("\n");
-		result = i64_multiply(result, i64_fromBits(10, 0));
-		printf("fromDouble iteration %d: shift result ", idx);
-		i64_debugPrintDecimal(result);
-		printf("\n");
-		result = i64_add(result, i64_fromBits(intermediate[idx] - '0', 0));
-		printf("fromDouble iteration %d: add result ", idx);
-		i64_debugPrintDecimal(result);
-		printf("\n");
-		printf("fromDouble iteration %d: result_out = ", idx);
-		i64_debugPrintDecimal(result);
-		printf("\n");
-	}
-	
-	/* Negate resulting value if needed */
-	if(sign == -1) {
-		result = i64_negate(result);
+
+	/* From here on, 1 <= value < 2^63. */
+#ifdef I64_ASSUME_IEEE754
+	/* find which word holds the sign and exponent, since
+		that follows the platform's endianness. */
+	one.d = 1.0;
+	hi = (one.w[1] == 0x3FF00000) ? 1 : 0;
+
+	bits.d = value;
+	highWord = bits.w[hi];
+	mantissa = i64_fromBits(bits.w[1 - hi],
+		(highWord & 0xFFFFF) | 0x100000);
+		/* restore the implicit leading 1 */
+	exponent = (int)((highWord >> 20) & 0x7FF) - 1023 - 52;
+#else
+	frac = frexp(value, &exponent);
+		/* value == frac * 2^exponent, 0.5 <= frac < 1 */
+	top = floor(ldexp(frac, 21));
+	mantissa = i64_fromBits(
+		(u32)(ldexp(frac, 53) - ldexp(top, 32)),
+		(i32)top
+	);
+	exponent -= 53;
+#endif
+
+	/* value == mantissa * 2^exponent; shifting right
+		drops (truncates) any fractional bits. */
+	if(exponent >= 0) {
+		return i64_shiftLeft(mantissa, exponent);
+	} else {
+		return i64_shiftRightUnsigned(mantissa, -exponent);
 	}
-	
-	return result;
 }
 
 /*
 	The C equivalent of goog.math.Long's
 	Long.toNumber() routine, recalling that ES6
 	Numbers are just doubles.
-*/
-double i64_toDouble(i64 this) {
-	i32 neg_p = this.high_ & 0x80000000;
-	double  top, bottom, toRet, scratchf;
 	
-	if(neg_p != 0) {
-		/* this = abs(this) */
-		this = i64_negate(this);
-		assert((this.high_ & 0x80000000) == 0);
-	}
+	Correctly rounded (to nearest, ties to even) above
+	2^53. Both high_ * 2^32 and the unsigned low word are
+	exact as doubles, so the one rounding is that of
+	their sum -- which is exactly what IEEE 754 addition
+	does.
+*/
+I64_API double i64_toDouble(i64 this) {
+#ifdef I64_USE_NATIVE
+	return (double)I64_TO_S64_(this);
+#else
+	return this.high_ * TWO_PWR_32_DBL_ + (double)i64_getLowBitsUnsigned(this);
+#endif
+}
 
-	top = (u32)this.high_ * (double)TWO_PWR_32_DBL_;
-	bottom = (u32)this.low_;
-	assert((top >= 0) && (bottom >= 0));
-	toRet = top + bottom;
-	
-	if(neg_p != 0) {
-		toRet *= -1;
+/* Converts the n values at 'a' to doubles, as i64_toDouble. */
+I64_API void i64_toDoubleArray(double *I64_RESTRICT out,
+		const i64 *I64_RESTRICT a, size_t n) {
+	size_t i;
+	for(i = 0; i < n; i++) {
+		out[i] = a[i].high_ * TWO_PWR_32_DBL_
+			+ (double)i64_getLowBitsUnsigned(a[i]);
 	}
-
-	printf("i64_toDouble absolute values: %f + %f\n", top, bottom);
-	
-	/* ASSUMPTION: result double has no fractional part */
-	assert(modf(toRet, &scratchf) == 0);
-	printf("i64_toDouble xx: %a == %a = %d\n", toRet, floor(toRet), toRet == floor(toRet));
-	assert(toRet == floor(toRet));
-	
-	return toRet;
 }
 
 /*
@@ -530,7 +758,7 @@ double i64_toDouble(i64 this) {
 	within the mantissa of a double, with range +/-
 	2^53?
 */
-int i64_isSafeInteger(i64 this) {
+I64_API int i64_isSafeInteger(i64 this) {
 	i32 top11Bits = this.high_ >> 21;
 	return
 		top11Bits == 0 /* positive case */
@@ -538,33 +766,437 @@ int i64_isSafeInteger(i64 this) {
 				/* ... and exclude -2^53 proper. */
 			&& !(this.low_ == 0 & this.high_ == (0xffe00000 | 0)));
 }
+#endif
+
+/*
+	STRING CONVERSIONS
+	------------------
+	i64_toString writes 'this' in the given radix (2 to 36,
+	with lowercase letters for digits past 9, as in
+	goog.math.Long) to 'strOut', NUL-terminated, and
+	returns one of the codes below. On failure, 'strOut'
+	holds the empty string (if it has room for one).
+	I64_MAX_STRING_LENGTH bytes always suffice.
+*/
 
 #define I64_TOFROMSTR_SUCC 0
 #define I64_TOFROMSTR_FAIL_RADIX 1
+#define I64_TOFROMSTR_FAIL_LENGTH 2
+	/* the output buffer is too short */
 
-// int i64_toString(i64 this, int radix, char *strOut, int outLen) {
-	// /* Check radix in/out of range; */
-	// if(radix < 2 || 36 < radix) {
-		// strOut[0] = 0;
-		// return I64_TOFROMSTR_FAIL_RADIX;
-	// }
-	
-	// /* Begin string conversion by adding a sentinel to the
-		// output buffer; */
-	// strOut[outLen - 1] = 0;
+#define I64_MAX_STRING_LENGTH 66
+	/* a sign, 64 binary digits and the NUL */
+
+#ifdef I64_DEFINE_
+static const char I64_DIGITS_[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+/* "00", "01", ... "99", for writing decimals two digits at a time. */
+static const char I64_DIGIT_PAIRS_[] =
+	"00010203040506070809101112131415161718192021222324"
+	"25262728293031323334353637383940414243444546474849"
+	"50515253545556575859606162636465666768697071727374"
+	"75767778798081828384858687888990919293949596979899";
+
+/*
+	Writes the decimal digits of 'value' backwards, ending
+	just before 'end', and returns where they start: exactly
+	'width' digits (zero-padded), or if 'width' is 0, as many
+	as 'value' needs.
+*/
+I64_API char *i64_putDecimal_(char *end, u32 value, int width) {
+	u32 pair;
+	while(value >= 100 || width > 2) {
+		pair = (value % 100) * 2;
+		value /= 100;
+		*--end = I64_DIGIT_PAIRS_[pair + 1];
+		*--end = I64_DIGIT_PAIRS_[pair];
+		width -= 2;
+	}
+	if(value >= 10 || width == 2) {
+		*--end = I64_DIGIT_PAIRS_[value * 2 + 1];
+		*--end = I64_DIGIT_PAIRS_[value * 2];
+	} else {
+		*--end = (char)('0' + value);
+	}
+	return end;
+}
+
+/* As i64_putDecimal_, in any radix, a digit at a time. */
+I64_API char *i64_putDigits_(char *end, u32 value, u32 radix, int width) {
+	do {
+		*--end = I64_DIGITS_[value % radix];
+		value /= radix;
+		width--;
+	} while(value != 0 || width > 0);
+	return end;
+}
+
+/*
+	Divides the unsigned 64-bit (high, low) in place by
+	'divisor', which must be at most 2^16, and returns the
+	remainder: long division by 16-bit digits, so that each
+	partial dividend fits in a u32.
+*/
+I64_API u32 i64_divSmall_(u32 *high, u32 *low, u32 divisor) {
+	u32 t, q3, q2, q1, q0;
+	t = *high >> 16;
+	q3 = t / divisor;
+	t = ((t - q3 * divisor) << 16) | (*high & 0xFFFF);
+	q2 = t / divisor;
+	t = ((t - q2 * divisor) << 16) | (*low >> 16);
+	q1 = t / divisor;
+	t = ((t - q1 * divisor) << 16) | (*low & 0xFFFF);
+	q0 = t / divisor;
+	*high = (q3 << 16) | q2;
+	*low = (q1 << 16) | q0;
+	return t - q0 * divisor;
+}
+
+I64_API int i64_ctz32_(u32 x);
+	/* Forward ref. -- defined with the bit scans below. */
+
+/*
+	Writes the digits of 'this', read as unsigned, backwards
+	ending just before 'end', and returns where they start.
 	
+	While the value needs more than 32 bits, we divide off
+	chunks of several digits at once -- 10^9 (natively) or
+	10^4 (16-bit long division) for decimal -- and then
+	finish on a u32. Power-of-two radixes need only shifts.
+*/
+I64_API char *i64_putUnsigned_(char *end, i64 this, int radix) {
+	u32 high = (u32)this.high_, low = (u32)this.low_;
+	u32 chunkPower;
+	int chunkWidth, bits;
+#ifdef I64_USE_NATIVE
+	u64_native_ value = I64_TO_U64_(this), quot;
+#else
+	u32 chunk;
+#endif
+
+	if((radix & (radix - 1)) == 0) {
+		bits = i64_ctz32_((u32)radix);
+		do {
+			*--end = I64_DIGITS_[low & (radix - 1)];
+			low = (low >> bits) | (high << (32 - bits));
+			high >>= bits;
+		} while((low | high) != 0);
+		return end;
+	}
+
+#ifdef I64_USE_NATIVE
+	if(radix == 10) {
+		while(value > 0xFFFFFFFF) {
+			quot = value / 1000000000;
+			end = i64_putDecimal_(end, (u32)(value - quot * 1000000000), 9);
+			value = quot;
+		}
+		return i64_putDecimal_(end, (u32)value, 0);
+	}
+	/* the largest power of the radix that fits in a u32 */
+	for(chunkPower = radix, chunkWidth = 1;
+			chunkPower <= 0xFFFFFFFF / (u32)radix;
+			chunkPower *= radix, chunkWidth++)
+		;
+	while(value > 0xFFFFFFFF) {
+		quot = value / chunkPower;
+		end = i64_putDigits_(end, (u32)(value - quot * chunkPower),
+			radix, chunkWidth);
+		value = quot;
+	}
+	return i64_putDigits_(end, (u32)value, radix, 0);
+#else
+	if(radix == 10) {
+		while(high != 0) {
+			chunk = i64_divSmall_(&high, &low, 10000);
+			end = i64_putDecimal_(end, chunk, 4);
+		}
+		return i64_putDecimal_(end, low, 0);
+	}
+	/* the largest power of the radix that is at most 2^16 */
+	for(chunkPower = radix, chunkWidth = 1;
+			chunkPower <= 0x10000 / (u32)radix;
+			chunkPower *= radix, chunkWidth++)
+		;
+	while(high != 0) {
+		chunk = i64_divSmall_(&high, &low, chunkPower);
+		end = i64_putDigits_(end, chunk, radix, chunkWidth);
+	}
+	return i64_putDigits_(end, low, radix, 0);
+#endif
+}
+
+/*
+	Copies the 'length' characters at 'digits', and a NUL,
+	to 'strOut', if it has room for them.
+*/
+I64_API int i64_copyString_(const char *digits, int length, char *strOut,
+		int outLen) {
+	int i;
+	if(length >= outLen) {
+		if(outLen > 0) {
+			strOut[0] = 0;
+		}
+		return I64_TOFROMSTR_FAIL_LENGTH;
+	}
+	for(i = 0; i < length; i++) {
+		strOut[i] = digits[i];
+	}
+	strOut[length] = 0;
+	return I64_TOFROMSTR_SUCC;
+}
+
+I64_API int i64_toString(i64 this, int radix, char *strOut, int outLen) {
+	char buffer[I64_MAX_STRING_LENGTH];
+	char *end = buffer + sizeof buffer, *start;
+
+	if(radix < 2 || 36 < radix) {
+		if(outLen > 0) {
+			strOut[0] = 0;
+		}
+		return I64_TOFROMSTR_FAIL_RADIX;
+	}
+	/* negating the min value gives 2^63 as unsigned,
+		which is its magnitude. */
+	start = i64_putUnsigned_(end,
+		i64_isNegative(this) ? i64_negate(this) : this, radix);
+	if(i64_isNegative(this)) {
+		*--start = '-';
+	}
+	return i64_copyString_(start, (int)(end - start), strOut, outLen);
+}
+
+/* As i64_toString, treating 'this' as unsigned. */
+I64_API int i64_toUnsignedString(i64 this, int radix, char *strOut,
+		int outLen) {
+	char buffer[I64_MAX_STRING_LENGTH];
+	char *end = buffer + sizeof buffer, *start;
+
+	if(radix < 2 || 36 < radix) {
+		if(outLen > 0) {
+			strOut[0] = 0;
+		}
+		return I64_TOFROMSTR_FAIL_RADIX;
+	}
+	start = i64_putUnsigned_(end, this, radix);
+	return i64_copyString_(start, (int)(end - start), strOut, outLen);
+}
+#endif
+
+/*
+	i64_fromString parses the 'inLen' characters at 'strIn'
+	-- an optional '-', then digits in the given radix,
+	in either case -- and stores one of the codes below in
+	'*outStatus' (unless it is NULL). Unlike goog.math.Long,
+	values out of range are errors rather than wrapping
+	around; i64_fromUnsignedString reads [0, 2^64 - 1].
+	On failure, we return 0.
+*/
+
+#define I64_TOFROMSTR_FAIL_DIGIT 3
+	/* empty, or a character that is not a digit */
+#define I64_TOFROMSTR_FAIL_RANGE 4
+	/* the value does not fit */
+
+#ifdef I64_DEFINE_
+/* The value of each character as a digit; 255 if none. */
+static const unsigned char I64_DIGIT_VALUES_[256] = {
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 255, 255, 255, 255, 255, 255,
+	255, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24,
+	25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 255, 255, 255, 255, 255,
+	255, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24,
+	25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255
+};
+
+I64_API i64 i64_multiplyFullUnsigned(i64 this, i64 other, i64 *high);
+	/* Forward ref. -- defined with the other multiplication
+		routines below. */
+
+/* Four characters as a u32, the first in the low byte. */
+#define I64_LOAD4_(p) \
+	((u32)(unsigned char)(p)[0] | ((u32)(unsigned char)(p)[1] << 8) \
+		| ((u32)(unsigned char)(p)[2] << 16) \
+		| ((u32)(unsigned char)(p)[3] << 24))
+
+/*
+	Parses 8 decimal digits with SWAR ("SIMD within a
+	register") on two 32-bit words, storing their value in
+	'*out' and returning whether they were all digits.
 	
-	// /* Common cases that correspond to */
+	A byte is a digit when its high nibble is 3 and adding 6
+	leaves it so. Subtracting '0' from every byte leaves
+	the digit values, which we combine pairwise -- the
+	first digit of each pair is in the lower byte -- into
+	two-digit values in alternate bytes, and those pairwise
+	again into four-digit values.
+*/
+I64_API int i64_parse8Digits_(const char *str, u32 *out) {
+	u32 first = I64_LOAD4_(str), second = I64_LOAD4_(str + 4);
+	int valid =
+		((first & 0xF0F0F0F0) == 0x30303030)
+		& (((first + 0x06060606) & 0xF0F0F0F0) == 0x30303030)
+		& ((second & 0xF0F0F0F0) == 0x30303030)
+		& (((second + 0x06060606) & 0xF0F0F0F0) == 0x30303030);
+
+	first -= 0x30303030;
+	second -= 0x30303030;
+	first = (first * 10 + (first >> 8)) & 0x00FF00FF;
+	second = (second * 10 + (second >> 8)) & 0x00FF00FF;
+	first = (first * 100 + (first >> 16)) & 0xFFFF;
+	second = (second * 100 + (second >> 16)) & 0xFFFF;
+	*out = first * 10000 + second;
+	return valid;
+}
+
+/*
+	Parses the unsigned decimal at 'str' into '*out', if it
+	is at most 'limit' (as unsigned).
 	
-	// finish_successfully:
-	// /* Before finishing (successfully), check to see whether the
-		// sentinel is intact; if not, fail fast; */
-	// assert(strOut[outLen - 1] == 0);
-	// return I64_TOFROMSTR_SUCC;
-// }
+	After any leading zeros, at most 20 digits can fit:
+	a head of up to 7 digits, parsed one at a time, and
+	up to two 8-digit chunks, each added in after a
+	multiply by 10^8. Only the second of those multiplies
+	can overflow, which it does exactly when the value so
+	far exceeds floor((2^64 - 1) / 10^8).
+*/
+I64_API int i64_parseDecimal_(const char *str, int len, i64 limit, i64 *out) {
+	i64 value, tenToThe8 = i64_fromBits(100000000, 0);
+	i64 maxBefore8 = i64_fromBits((i32)0xF31DC461, 0x2A);
+		/* floor((2^64 - 1) / 10^8) */
+	u32 head = 0, digit, chunk;
+	int valid = 1, headLen, i;
+
+	while(len > 1 && *str == '0') {
+		str++;
+		len--;
+	}
+	if(len > 20) {
+		for(i = 0; i < len; i++) {
+			if((u32)(unsigned char)str[i] - '0' >= 10) {
+				return I64_TOFROMSTR_FAIL_DIGIT;
+			}
+		}
+		return I64_TOFROMSTR_FAIL_RANGE;
+	}
+
+	headLen = len % 8;
+	for(i = 0; i < headLen; i++) {
+		digit = (u32)(unsigned char)str[i] - '0';
+		valid &= digit < 10;
+		head = head * 10 + digit;
+	}
+	value = i64_fromBits((i32)head, 0);
+	for(; i < len; i += 8) {
+		valid &= i64_parse8Digits_(str + i, &chunk);
+		if(i + 8 == len && len > 16 && (i64_compareUnsigned(value, maxBefore8) > 0
+				|| (i64_equals(value, maxBefore8) & (chunk > 9551615)))) {
+			return valid ? I64_TOFROMSTR_FAIL_RANGE : I64_TOFROMSTR_FAIL_DIGIT;
+		}
+		value = i64_add(i64_multiply(value, tenToThe8),
+			i64_fromBits((i32)chunk, 0));
+	}
+	if(!valid) {
+		return I64_TOFROMSTR_FAIL_DIGIT;
+	}
+	if(i64_compareUnsigned(value, limit) > 0) {
+		return I64_TOFROMSTR_FAIL_RANGE;
+	}
+	*out = value;
+	return I64_TOFROMSTR_SUCC;
+}
+
+/*
+	As i64_parseDecimal_, in any radix: we read as many
+	digits at a time as fit in a u32, and add each such
+	chunk in after a full 128-bit multiply, whose high half
+	shows any overflow.
+*/
+I64_API int i64_parseDigits_(int radix, const char *str, int len, i64 limit,
+		i64 *out) {
+	i64 value = I64_ZERO, high, sum;
+	u32 chunk, chunkPower, digit;
+	int valid = 1, overflow = 0, i;
+
+	for(i = 0; i < len; ) {
+		chunk = 0;
+		chunkPower = 1;
+		for(; i < len && chunkPower <= 0xFFFFFFFF / (u32)radix; i++) {
+			digit = I64_DIGIT_VALUES_[(unsigned char)str[i]];
+			valid &= digit < (u32)radix;
+			chunk = chunk * radix + digit;
+			chunkPower *= radix;
+		}
+		value = i64_multiplyFullUnsigned(value, i64_fromBits((i32)chunkPower, 0),
+			&high);
+		sum = i64_add(value, i64_fromBits((i32)chunk, 0));
+		overflow |= !i64_isZero(high)
+			| (i64_compareUnsigned(sum, value) < 0);
+		value = sum;
+	}
+	if(!valid) {
+		return I64_TOFROMSTR_FAIL_DIGIT;
+	}
+	if(overflow || i64_compareUnsigned(value, limit) > 0) {
+		return I64_TOFROMSTR_FAIL_RANGE;
+	}
+	*out = value;
+	return I64_TOFROMSTR_SUCC;
+}
+
+/* Parses an unsigned magnitude, at most 'limit'. */
+I64_API int i64_parseMagnitude_(int radix, const char *str, int len, i64 limit,
+		i64 *out) {
+	if(radix < 2 || 36 < radix) {
+		return I64_TOFROMSTR_FAIL_RADIX;
+	}
+	if(len <= 0) {
+		return I64_TOFROMSTR_FAIL_DIGIT;
+	}
+	if(radix == 10) {
+		return i64_parseDecimal_(str, len, limit, out);
+	}
+	return i64_parseDigits_(radix, str, len, limit, out);
+}
 
+I64_API i64 i64_fromString(int radix, const char *strIn, int inLen,
+		int *outStatus) {
+	i64 ret = I64_ZERO;
+	int status, neg = inLen > 0 && strIn[0] == '-';
+
+	/* the magnitude of the min value is 2^63, which
+		as unsigned is its own bit pattern. */
+	status = i64_parseMagnitude_(radix, strIn + neg, inLen - neg,
+		neg ? I64_MIN : I64_MAX, &ret);
+	if(outStatus != NULL) {
+		*outStatus = status;
+	}
+	if(status != I64_TOFROMSTR_SUCC) {
+		return I64_ZERO;
+	}
+	return neg ? i64_negate(ret) : ret;
+}
 
-i64 i64_fromString(int radix, char *strIn, int inLen, int *outStatus);
+I64_API i64 i64_fromUnsignedString(int radix, const char *strIn, int inLen,
+		int *outStatus) {
+	i64 ret = I64_ZERO;
+	int status = i64_parseMagnitude_(radix, strIn, inLen,
+		I64_NEG_ONE, &ret);
+	if(outStatus != NULL) {
+		*outStatus = status;
+	}
+	return status == I64_TOFROMSTR_SUCC ? ret : I64_ZERO;
+}
 
 /*
 	BITWISE OPERATIONS
@@ -572,21 +1204,21 @@ i64 i64_fromString(int radix, char *strIn, int inLen, int *outStatus);
 */
 
 
-i64 i64_not(i64 this) {
+I64_API i64 i64_not(i64 this) {
 	return i64_fromBits(~this.low_, ~this.high_);
 }
 
-i64 i64_and(i64 this, i64 other) {
+I64_API i64 i64_and(i64 this, i64 other) {
 	return i64_fromBits
 		(this.low_ & other.low_, this.high_ & other.high_);
 }
 
-i64 i64_or(i64 this, i64 other) {
+I64_API i64 i64_or(i64 this, i64 other) {
 	return i64_fromBits
 		(this.low_ | other.low_, this.high_ | other.high_);
 }
 
-i64 i64_xor(i64 this, i64 other) {
+I64_API i64 i64_xor(i64 this, i64 other) {
 	return i64_fromBits
 		(this.low_ ^ other.low_, this.high_ ^ other.high_);
 }
@@ -604,11 +1236,16 @@ i64 i64_xor(i64 this, i64 other) {
 	by negative values work as expected.
 */
 
-i64 i64_shiftRight(i64 this, i32 numBits);
+I64_API i64 i64_shiftRight(i64 this, i32 numBits);
 	/* Forward ref. needed for left and right
 		shift to call each other as needed */
 		
-i64 i64_shiftLeft(i64 this, i32 numBits) {
+I64_API i64 i64_shiftLeft(i64 this, i32 numBits) {
+#ifdef I64_USE_NATIVE
+	if(numBits < 0)
+		return i64_shiftRight(this, -numBits);
+	return i64_fromU64_(I64_TO_U64_(this) << (numBits & 63));
+#else
 	i32 low, high;
 	
 	/* this next control path, that implements
@@ -626,7 +1263,7 @@ i64 i64_shiftLeft(i64 this, i32 numBits) {
 			high = this.high_;
 			return i64_fromBits(
 				low << numBits,
-				(high << numBits) | (((i32)low) >> (32 - numBits))
+				(high << numBits) | SHR32F0(low, 32 - numBits)
 			);
 		} else {
 			return i64_fromBits(
@@ -635,10 +1272,16 @@ i64 i64_shiftLeft(i64 this, i32 numBits) {
 			);
 		}
 	}
+#endif
 }
 
 /* Shift right, retaining the current sign. */
-i64 i64_shiftRight(i64 this, i32 numBits) {
+I64_API i64 i64_shiftRight(i64 this, i32 numBits) {
+#ifdef I64_USE_NATIVE
+	if(numBits < 0)
+		return i64_shiftLeft(this, -numBits);
+	return i64_fromU64_((u64_native_)(I64_TO_S64_(this) >> (numBits & 63)));
+#else
 	i32 low, high;
 	
 	/* this next control path, that implements
@@ -655,7 +1298,7 @@ i64 i64_shiftRight(i64 this, i32 numBits) {
 		if(numBits < 32) {
 			low = this.low_;
 			return i64_fromBits(
-				(((i32)low) >> numBits) | (high << (32 - numBits)),
+				SHR32F0(low, numBits) | (high << (32 - numBits)),
 				high >> numBits
 			);
 		} else {
@@ -665,10 +1308,16 @@ i64 i64_shiftRight(i64 this, i32 numBits) {
 			);
 		}
 	}
+#endif
 }
 
 /* Shift right, replacing leading bits with 0s. */
-i64 i64_shiftRightUnsigned(i64 this, i32 numBits) {
+I64_API i64 i64_shiftRightUnsigned(i64 this, i32 numBits) {
+#ifdef I64_USE_NATIVE
+	if(numBits < 0)
+		return i64_shiftLeft(this, -numBits);
+	return i64_fromU64_(I64_TO_U64_(this) >> (numBits & 63));
+#else
 	i32 low, high;
 	
 	/* this next control path, that implements
@@ -685,29 +1334,1838 @@ i64 i64_shiftRightUnsigned(i64 this, i32 numBits) {
 		if(numBits < 32) {
 			low = this.low_;
 			return i64_fromBits(
-				(((i32)low) >> numBits) | (high << (32 - numBits)),
-				((i32)high) >> numBits
+				SHR32F0(low, numBits) | (high << (32 - numBits)),
+				SHR32F0(high, numBits)
 			);
 		} else if(numBits == 32) {
 			return i64_fromBits(high, 0);
 		} else {
 			return i64_fromBits(
-				((i32)high) >> (numBits - 32),
+				SHR32F0(high, numBits - 32),
 				0
 			);
 		}
 	}
+#endif
 }
 
 /*
-	DIVISION
+	Rotates: bits shifted out of one end come back in at
+	the other. Any amount works, and is taken modulo 64,
+	so rotating left by -n rotates right by n.
+	
+	The C89 version has no branches: an amount of 32 or
+	more swaps the words (by masking), and what remains is
+	a rotate by under 32. We shift by 1 and then by
+	31 - n rather than by 32 - n, which for n = 0 would be
+	a shift by the full width.
+*/
+I64_API i64 i64_rotateLeft(i64 this, i32 numBits) {
+#ifdef I64_USE_NATIVE
+	u64_native_ a = I64_TO_U64_(this);
+	numBits &= 63;
+	return i64_fromU64_((a << numBits) | (a >> ((64 - numBits) & 63)));
+#else
+	u32 swap = 0 - (u32)((numBits >> 5) & 1);
+	u32 low = ((u32)this.low_ & ~swap) | ((u32)this.high_ & swap);
+	u32 high = ((u32)this.high_ & ~swap) | ((u32)this.low_ & swap);
+	numBits &= 31;
+	return i64_fromBits(
+		(i32)((low << numBits) | (high >> 1 >> (31 - numBits))),
+		(i32)((high << numBits) | (low >> 1 >> (31 - numBits)))
+	);
+#endif
+}
+
+I64_API i64 i64_rotateRight(i64 this, i32 numBits) {
+	return i64_rotateLeft(this, 64 - (numBits & 63));
+}
+
+#endif
+
+/*
+	Shifts and rotates by constant amounts: 'n' must be an
+	integer constant in [0, 63], with which the compiler
+	folds away the choice between the two halves below,
+	leaving straight-line code. 'x' is evaluated more than
+	once. (The amounts are masked with 31 in both halves
+	so that neither shifts by the full width of a word.)
+*/
+#ifdef I64_USE_NATIVE
+#define I64_SHL_CONST(x, n) i64_fromU64_(I64_TO_U64_(x) << (n))
+#define I64_SHR_CONST(x, n) \
+	i64_fromU64_((u64_native_)(I64_TO_S64_(x) >> (n)))
+#define I64_SHRU_CONST(x, n) i64_fromU64_(I64_TO_U64_(x) >> (n))
+#define I64_ROTL_CONST(x, n) \
+	i64_fromU64_((I64_TO_U64_(x) << (n)) \
+		| (I64_TO_U64_(x) >> ((64 - (n)) & 63)))
+#else
+#define I64_LOW_U32_(x) ((u32)(x).low_)
+#define I64_HIGH_U32_(x) ((u32)(x).high_)
+
+#define I64_SHL_CONST(x, n) i64_fromBits( \
+	(n) < 32 ? (i32)(I64_LOW_U32_(x) << ((n) & 31)) : 0, \
+	(n) < 32 \
+		? (i32)((I64_HIGH_U32_(x) << ((n) & 31)) \
+			| (I64_LOW_U32_(x) >> 1 >> (31 - ((n) & 31)))) \
+		: (i32)(I64_LOW_U32_(x) << ((n) & 31)))
+#define I64_SHR_CONST(x, n) i64_fromBits( \
+	(n) < 32 \
+		? (i32)((I64_LOW_U32_(x) >> ((n) & 31)) \
+			| (I64_HIGH_U32_(x) << 1 << (31 - ((n) & 31)))) \
+		: (x).high_ >> ((n) & 31), \
+	(n) < 32 ? (x).high_ >> ((n) & 31) : (x).high_ >> 31)
+#define I64_SHRU_CONST(x, n) i64_fromBits( \
+	(n) < 32 \
+		? (i32)((I64_LOW_U32_(x) >> ((n) & 31)) \
+			| (I64_HIGH_U32_(x) << 1 << (31 - ((n) & 31)))) \
+		: (i32)(I64_HIGH_U32_(x) >> ((n) & 31)), \
+	(n) < 32 ? (i32)(I64_HIGH_U32_(x) >> ((n) & 31)) : 0)
+#define I64_ROTL_CONST(x, n) i64_fromBits( \
+	(n) < 32 \
+		? (i32)((I64_LOW_U32_(x) << ((n) & 31)) \
+			| (I64_HIGH_U32_(x) >> 1 >> (31 - ((n) & 31)))) \
+		: (i32)((I64_HIGH_U32_(x) << ((n) & 31)) \
+			| (I64_LOW_U32_(x) >> 1 >> (31 - ((n) & 31)))), \
+	(n) < 32 \
+		? (i32)((I64_HIGH_U32_(x) << ((n) & 31)) \
+			| (I64_LOW_U32_(x) >> 1 >> (31 - ((n) & 31)))) \
+		: (i32)((I64_LOW_U32_(x) << ((n) & 31)) \
+			| (I64_HIGH_U32_(x) >> 1 >> (31 - ((n) & 31)))))
+#endif
+#define I64_ROTR_CONST(x, n) I64_ROTL_CONST(x, (64 - (n)) & 63)
+
+/*
+	BIT SCANS
+	=========
+	Counting leading and trailing zeros, and set bits. We
+	work on the two 32-bit words, with the compiler's
+	builtins where it has them, and otherwise with
+	branch-free portable versions: de Bruijn sequences for
+	the scans (cf. Hacker's Delight, 5-3 and 5-4), and a
+	SWAR sum of bit fields for the count (5-1).
+*/
+
+#if defined(__GNUC__) || defined(__clang__)
+	#define I64_HAVE_BUILTIN_CLZ_
+#elif defined(_MSC_VER)
+	#include <intrin.h>
+	#define I64_HAVE_BITSCAN_
+	#if defined(__AVX__)
+		/* every CPU with AVX has popcnt, which __popcnt
+			emits unconditionally. */
+		#define I64_HAVE_POPCNT_
+	#endif
+#endif
+
+#ifdef I64_DEFINE_
+/* maps the de Bruijn products to bit positions. */
+static const int I64_DEBRUIJN_LOG2_[32] = {
+	0, 9, 1, 10, 13, 21, 2, 29, 11, 14, 16, 18, 22, 25, 3, 30,
+	8, 12, 20, 28, 15, 17, 24, 7, 19, 27, 23, 6, 26, 5, 4, 31
+};
+static const int I64_DEBRUIJN_CTZ_[32] = {
+	0, 1, 28, 2, 29, 14, 24, 3, 30, 22, 20, 15, 25, 17, 4, 8,
+	31, 27, 13, 23, 21, 19, 16, 7, 26, 12, 18, 6, 11, 5, 10, 9
+};
+
+/* The leading zeros of a 32-bit word; 32 for 0. */
+I64_API int i64_clz32_(u32 x) {
+#if defined(I64_HAVE_BUILTIN_CLZ_)
+	return x == 0 ? 32 : __builtin_clz(x);
+#elif defined(I64_HAVE_BITSCAN_)
+	unsigned long index;
+	return _BitScanReverse(&index, x) ? 31 - (int)index : 32;
+#else
+	/* smear the top bit rightwards, to get 2^(log2(x) + 1) - 1 */
+	x |= x >> 1;
+	x |= x >> 2;
+	x |= x >> 4;
+	x |= x >> 8;
+	x |= x >> 16;
+	return 31 - I64_DEBRUIJN_LOG2_[((x * 0x07C4ACDDu) & 0xFFFFFFFF) >> 27]
+		+ (x == 0);
+#endif
+}
+
+/* The trailing zeros of a 32-bit word; 32 for 0. */
+I64_API int i64_ctz32_(u32 x) {
+#if defined(I64_HAVE_BUILTIN_CLZ_)
+	return x == 0 ? 32 : __builtin_ctz(x);
+#elif defined(I64_HAVE_BITSCAN_)
+	unsigned long index;
+	return _BitScanForward(&index, x) ? (int)index : 32;
+#else
+	/* x & -x isolates the lowest set bit */
+	return I64_DEBRUIJN_CTZ_[
+		(((x & (0 - x)) * 0x077CB531u) & 0xFFFFFFFF) >> 27]
+		+ ((x == 0) << 5);
+#endif
+}
+
+/* The set bits of a 32-bit word. */
+I64_API int i64_popcount32_(u32 x) {
+#if defined(I64_HAVE_BUILTIN_CLZ_)
+	return __builtin_popcount(x);
+#elif defined(I64_HAVE_POPCNT_)
+	return (int)__popcnt(x);
+#else
+	x = x - ((x >> 1) & 0x55555555);
+	x = (x & 0x33333333) + ((x >> 2) & 0x33333333);
+	x = (x + (x >> 4)) & 0x0F0F0F0F;
+	return (int)(((x * 0x01010101) & 0xFFFFFFFF) >> 24);
+#endif
+}
+
+/* The number of leading zero bits; 64 for 0. */
+I64_API int i64_numberOfLeadingZeros(i64 this) {
+	int high = i64_clz32_((u32)this.high_);
+	return high + (i64_clz32_((u32)this.low_) & -(high == 32));
+}
+
+/* The number of trailing zero bits; 64 for 0. */
+I64_API int i64_numberOfTrailingZeros(i64 this) {
+	int low = i64_ctz32_((u32)this.low_);
+	return low + (i64_ctz32_((u32)this.high_) & -(low == 32));
+}
+
+/* The number of set bits. */
+I64_API int i64_bitCount(i64 this) {
+	return i64_popcount32_((u32)this.low_) + i64_popcount32_((u32)this.high_);
+}
+
+/*
+	The number of bits needed to represent the absolute
+	value of 'this' -- at least 1, even for 0, as in
+	goog.math.Long. The min value, whose absolute value is
+	2^63, needs 64.
+*/
+I64_API int i64_getNumBitsAbs(i64 this) {
+	i64 abs = i64_isNegative(this) ? i64_negate(this) : this;
+	/* setting bit 0 only changes the answer for 0 */
+	return 64 - i64_numberOfLeadingZeros(i64_or(abs, I64_ONE));
+}
+
+/*
+	DIVISION
 	========
 	...defined at the end because it uses plenty
 	of other routines.
 */
 
-/* i64_div: unlike other routines which are nearly
-	always constant time, div is of order O????? */
+/*
+	We divide with Knuth's Algorithm D (cf. Hacker's Delight,
+	9-2, 'divmnu'), using the same representation as i64_add
+	and i64_multiply: little-endian 16-bit digits, each held
+	in a 32-bit int so that a digit product or a two-digit
+	partial dividend never overflows.
+
+	Unlike the other routines, which are nearly constant time,
+	division does O(m * n) digit operations for an m-digit
+	dividend and an n-digit divisor -- at most 16 for two i64s.
+*/
+
+#define I64_DIGIT_BASE_ 0x10000
+#define I64_DIGIT_MASK_ 0xFFFF
+#define I64_MAX_DIGITS_ 8
+	/* enough for a 128-bit dividend. */
+
+/*
+	Splits 'this' into four 16-bit digits, lowest first, and
+	returns the number of significant digits (0 for zero).
+*/
+I64_API int i64_toDigits_(i64 this, u32 *digits) {
+	int n;
+	digits[0] = this.low_ & I64_DIGIT_MASK_;
+	digits[1] = SHR32F0(this.low_, 16);
+	digits[2] = this.high_ & I64_DIGIT_MASK_;
+	digits[3] = SHR32F0(this.high_, 16);
+	for(n = 4; n > 0 && digits[n - 1] == 0; n--)
+		;
+	return n;
+}
+
+I64_API i64 i64_fromDigits_(const u32 *digits) {
+	return i64_fromBits(
+		(digits[1] << 16) | digits[0],
+		(digits[3] << 16) | digits[2]
+	);
+}
+
+/*
+	Divides the m-digit 'u' by the n-digit 'v', writing the
+	m - n + 1 quotient digits to 'q' and the n remainder digits
+	to 'r' (unless 'r' is NULL).
+	Requires m >= n >= 1, v[n - 1] != 0, and m <= I64_MAX_DIGITS_.
+*/
+I64_API void i64_divmnu_(u32 *q, u32 *r,
+		const u32 *u, const u32 *v, int m, int n) {
+	u32 un[I64_MAX_DIGITS_ + 1], vn[4];
+	u32 qhat, rhat, p, carry;
+	i32 t, borrow;
+	int s, i, j;
+
+	if(n == 1) {
+		/* Short division: each partial remainder is less
+			than v[0], so remainder * base + digit fits a u32. */
+		carry = 0;
+		for(j = m - 1; j >= 0; j--) {
+			p = carry * I64_DIGIT_BASE_ + u[j];
+			q[j] = p / v[0];
+			carry = p - q[j] * v[0];
+		}
+		if(r != NULL) {
+			r[0] = carry;
+		}
+		return;
+	}
+
+	/* Normalize: shift v left until the top bit of its top
+		digit is set, and shift u along with it (into an extra
+		digit). This keeps qhat within 2 of the true digit. */
+	s = i64_clz32_(v[n - 1]) - 16;
+
+	for(i = n - 1; i > 0; i--) {
+		vn[i] = ((v[i] << s) | (v[i - 1] >> (16 - s))) & I64_DIGIT_MASK_;
+	}
+	vn[0] = (v[0] << s) & I64_DIGIT_MASK_;
+
+	un[m] = u[m - 1] >> (16 - s);
+	for(i = m - 1; i > 0; i--) {
+		un[i] = ((u[i] << s) | (u[i - 1] >> (16 - s))) & I64_DIGIT_MASK_;
+	}
+	un[0] = (u[0] << s) & I64_DIGIT_MASK_;
+
+	for(j = m - n; j >= 0; j--) {
+		/* estimate the quotient digit from the top two digits
+			of the partial dividend, and refine it against the
+			second digit of the divisor. */
+		p = un[j + n] * I64_DIGIT_BASE_ + un[j + n - 1];
+		qhat = p / vn[n - 1];
+		rhat = p - qhat * vn[n - 1];
+		while(qhat >= I64_DIGIT_BASE_
+				|| qhat * vn[n - 2] > rhat * I64_DIGIT_BASE_ + un[j + n - 2]) {
+			qhat--;
+			rhat += vn[n - 1];
+			if(rhat >= I64_DIGIT_BASE_) {
+				break;
+			}
+		}
+
+		/* multiply and subtract. */
+		borrow = 0;
+		for(i = 0; i < n; i++) {
+			p = qhat * vn[i];
+			t = (i32)un[i + j] - borrow - (i32)(p & I64_DIGIT_MASK_);
+			un[i + j] = t & I64_DIGIT_MASK_;
+			borrow = (i32)(p >> 16) - (t >> 16);
+		}
+		t = (i32)un[j + n] - borrow;
+		un[j + n] = t & I64_DIGIT_MASK_;
+
+		/* we subtracted too much (rare): add one divisor back. */
+		q[j] = qhat;
+		if(t < 0) {
+			q[j]--;
+			carry = 0;
+			for(i = 0; i < n; i++) {
+				p = un[i + j] + vn[i] + carry;
+				un[i + j] = p & I64_DIGIT_MASK_;
+				carry = p >> 16;
+			}
+			un[j + n] = (un[j + n] + carry) & I64_DIGIT_MASK_;
+		}
+	}
+
+	/* un-normalize the remainder. */
+	if(r != NULL) {
+		for(i = 0; i < n - 1; i++) {
+			r[i] = ((un[i] >> s) | (un[i + 1] << (16 - s))) & I64_DIGIT_MASK_;
+		}
+		r[n - 1] = un[n - 1] >> s;
+	}
+}
+
+/*
+	Divides 'this' by 'other', treating both as unsigned
+	64-bit integers. Returns the quotient, and stores the
+	remainder in '*rem' unless 'rem' is NULL.
+	
+	Division by zero fails I64_ASSERT; otherwise (or with
+	assertions off) it gives a zero quotient and leaves 'this'
+	as the remainder.
+*/
+I64_API i64 i64_DivModUnsigned(i64 this, i64 other, i64 *rem) {
+#ifdef I64_USE_NATIVE
+	u64_native_ a = I64_TO_U64_(this), b = I64_TO_U64_(other);
+
+	I64_ASSERT(b != 0);
+	if(b == 0) {
+		if(rem != NULL) {
+			*rem = this;
+		}
+		return I64_ZERO;
+	}
+	if(rem != NULL) {
+		*rem = i64_fromU64_(a % b);
+	}
+	return i64_fromU64_(a / b);
+#else
+	u32 u[4], v[4], q[4], r[4];
+	int m, n;
+
+	/* Common case: both fit in 32 bits, so use the
+		platform's own division. */
+	if(this.high_ == 0 && other.high_ == 0 && other.low_ != 0) {
+		if(rem != NULL) {
+			*rem = i64_fromBits(
+				(u32)this.low_ % (u32)other.low_, 0);
+		}
+		return i64_fromBits((u32)this.low_ / (u32)other.low_, 0);
+	}
+
+	m = i64_toDigits_(this, u);
+	n = i64_toDigits_(other, v);
+	I64_ASSERT(n != 0);
+	if(n == 0 || m < n) {
+		if(rem != NULL) {
+			*rem = this;
+		}
+		return I64_ZERO;
+	}
+
+	q[0] = q[1] = q[2] = q[3] = 0;
+	r[0] = r[1] = r[2] = r[3] = 0;
+	i64_divmnu_(q, r, u, v, m, n);
+	if(rem != NULL) {
+		*rem = i64_fromDigits_(r);
+	}
+	return i64_fromDigits_(q);
+#endif
+}
+
+/*
+	Signed division, truncating towards zero, like
+	goog.math.Long's div(); the remainder (stored in '*rem'
+	unless 'rem' is NULL) takes the sign of 'this', like
+	goog.math.Long's modulo().
+	
+	As in goog.math.Long, (min value) / -1 overflows back to
+	the min value.
+*/
+I64_API i64 i64_DivMod(i64 this, i64 other, i64 *rem) {
+#ifdef I64_USE_NATIVE
+	i64_native_ a = I64_TO_S64_(this), b = I64_TO_S64_(other);
+
+	I64_ASSERT(b != 0);
+	if(b == 0 || b == -1) {
+		/* (min value) / -1 overflows natively, so negate
+			instead; division by zero behaves as below. */
+		if(rem != NULL) {
+			*rem = (b == 0) ? this : I64_ZERO;
+		}
+		return (b == 0) ? I64_ZERO : i64_negate(this);
+	}
+	if(rem != NULL) {
+		*rem = i64_fromU64_((u64_native_)(a % b));
+	}
+	return i64_fromU64_((u64_native_)(a / b));
+#else
+	i64 quot;
+	int thisNeg = i64_isNegative(this);
+	int otherNeg = i64_isNegative(other);
+
+	/* take absolute values; negating the min value gives
+		itself, which is exactly 2^63 when viewed as unsigned. */
+	quot = i64_DivModUnsigned(
+		thisNeg ? i64_negate(this) : this,
+		otherNeg ? i64_negate(other) : other,
+		rem
+	);
+
+	if(rem != NULL && thisNeg) {
+		*rem = i64_negate(*rem);
+	}
+	return (thisNeg != otherNeg) ? i64_negate(quot) : quot;
+#endif
+}
+
+I64_API i64 i64_div(i64 this, i64 other) {
+	return i64_DivMod(this, other, NULL);
+}
+
+I64_API i64 i64_modulo(i64 this, i64 other) {
+	i64 rem;
+	i64_DivMod(this, other, &rem);
+	return rem;
+}
+
+/*
+	WIDENING MULTIPLICATION
+	=======================
+	The full 128-bit product of two i64s, which i64_multiply
+	truncates to its low 64 bits. We use the same 16-bit
+	digits as division, so a 128-bit product is 8 digits.
+*/
+
+/*
+	Schoolbook multiplication (cf. Hacker's Delight, 8-1,
+	'mulmnu') of the m-digit 'u' by the n-digit 'v', writing
+	all m + n digits of the product to 'w'. Each step
+	computes digit * digit + digit + carry, which is at
+	most 2^32 - 1, so nothing overflows a u32.
+*/
+I64_API void i64_mulmnu_(u32 *w, const u32 *u, const u32 *v, int m, int n) {
+	u32 carry, t;
+	int i, j;
+
+	for(i = 0; i < m; i++) {
+		w[i] = 0;
+	}
+	for(j = 0; j < n; j++) {
+		carry = 0;
+		for(i = 0; i < m; i++) {
+			t = u[i] * v[j] + w[i + j] + carry;
+			w[i + j] = t & I64_DIGIT_MASK_;
+			carry = t >> 16;
+		}
+		w[j + m] = carry;
+	}
+}
+
+/*
+	Multiplies 'this' and 'other' as unsigned 64-bit integers,
+	returning the low 64 bits of the product (which are just
+	i64_multiply's) and storing the high 64 bits in '*high'.
+*/
+I64_API i64 i64_multiplyFullUnsigned(i64 this, i64 other, i64 *high) {
+#ifdef I64_USE_NATIVE
+	/* schoolbook again, with 32-bit digits in native
+		64-bit ints */
+	u64_native_ a = I64_TO_U64_(this), b = I64_TO_U64_(other);
+	u64_native_ a0 = a & 0xFFFFFFFF, a32 = a >> 32;
+	u64_native_ b0 = b & 0xFFFFFFFF, b32 = b >> 32;
+	u64_native_ p0 = a0 * b0, p32 = a32 * b0, p32b = a0 * b32;
+	u64_native_ mid = (p0 >> 32) + (p32 & 0xFFFFFFFF)
+		+ (p32b & 0xFFFFFFFF);
+
+	*high = i64_fromU64_(a32 * b32 + (p32 >> 32) + (p32b >> 32)
+		+ (mid >> 32));
+	return i64_fromU64_((mid << 32) | (p0 & 0xFFFFFFFF));
+#else
+	u32 u[4], v[4], w[8];
+
+	i64_toDigits_(this, u);
+	i64_toDigits_(other, v);
+	i64_mulmnu_(w, u, v, 4, 4);
+	*high = i64_fromDigits_(w + 4);
+	return i64_fromDigits_(w);
+#endif
+}
+
+/*
+	As i64_multiplyFullUnsigned, but treating 'this' and
+	'other' as signed: '*high' holds the sign-extended top
+	of the product.
+*/
+I64_API i64 i64_multiplyFull(i64 this, i64 other, i64 *high) {
+	i64 low = i64_multiplyFullUnsigned(this, other, high);
+
+	/* reading a negative i64 as unsigned adds 2^64 to it,
+		which adds 2^64 times the other operand to the product;
+		take that back off the high half. */
+	if(i64_isNegative(this)) {
+		*high = i64_subtract(*high, other);
+	}
+	if(i64_isNegative(other)) {
+		*high = i64_subtract(*high, this);
+	}
+	return low;
+}
+
+/*
+	The high 64 bits of the 128-bit product of 'this' and
+	'other', treated as unsigned.
+*/
+I64_API i64 i64_multiplyHighUnsigned(i64 this, i64 other) {
+	i64 high;
+	i64_multiplyFullUnsigned(this, other, &high);
+	return high;
+}
+
+/*
+	The high 64 bits of the signed 128-bit product of
+	'this' and 'other'.
+*/
+I64_API i64 i64_multiplyHigh(i64 this, i64 other) {
+	i64 high;
+	i64_multiplyFull(this, other, &high);
+	return high;
+}
+
+/*
+	INVARIANT DIVISORS
+	==================
+	When dividing many values by the same divisor, we can
+	do the expensive work once: an i64_divisor holds a
+	precomputed 'magic' reciprocal of the divisor, so that
+	each division is a high-half multiply and a few shifts
+	(cf. Granlund and Montgomery, "Division by Invariant
+	Integers using Multiplication", and Hacker's Delight,
+	10-8).
+	
+	We divide magnitudes and fix up signs afterwards, as
+	i64_DivMod does, and so get the same results as it.
+*/
+
+#define I64_DIVISOR_POW2_ 1
+	/* |divisor| is a power of two: shift only. */
+#define I64_DIVISOR_SMALL_ 2
+	/* |divisor| fits in 32 bits. */
+#define I64_DIVISOR_ADD_ 4
+	/* the magic number needs 65 bits; see i64_divByDivisor. */
+#define I64_DIVISOR_NEG_ 8
+	/* the divisor is negative. */
+
+#endif
+
+typedef struct {
+	i64 divisor_;
+	i64 abs_;
+		/* |divisor_|, as an unsigned value. */
+	i64 magic_;
+	int shift_;
+	int flags_;
+} i64_divisor;
+
+#ifdef I64_DEFINE_
+/*
+	Precomputes an i64_divisor for dividing by 'divisor'.
+	
+	A zero 'divisor' fails I64_ASSERT here; otherwise
+	(or with assertions off) it behaves like i64_DivMod,
+	giving a zero quotient.
+*/
+I64_API i64_divisor i64_makeDivisor(i64 divisor) {
+	i64_divisor ret;
+	u32 u[I64_MAX_DIGITS_], v[4], q[I64_MAX_DIGITS_], r[4];
+	i64 rem, twiceRem, lowBit;
+	int m, n, l, i;
+
+	ret.divisor_ = divisor;
+	ret.flags_ = i64_isNegative(divisor) ? I64_DIVISOR_NEG_ : 0;
+	ret.abs_ = i64_isNegative(divisor) ? i64_negate(divisor) : divisor;
+	ret.magic_ = I64_ZERO;
+	ret.shift_ = 0;
+
+	I64_ASSERT(!i64_isZero(divisor));
+	if(i64_isZero(divisor)) {
+		/* a zero magic number makes every quotient zero. */
+		return ret;
+	}
+	if(ret.abs_.high_ == 0) {
+		ret.flags_ |= I64_DIVISOR_SMALL_;
+	}
+
+	/* l = floor(log2(|divisor|)) */
+	n = i64_toDigits_(ret.abs_, v);
+	l = 63 - i64_numberOfLeadingZeros(ret.abs_);
+
+	if(i64_isZero(i64_and(ret.abs_,
+			i64_subtract(ret.abs_, I64_ONE)))) {
+		ret.flags_ |= I64_DIVISOR_POW2_;
+		ret.shift_ = l;
+		return ret;
+	}
+
+	/* magic = floor(2^(64 + l) / |divisor|), remainder rem */
+	m = (64 + l) / 16 + 1;
+	for(i = 0; i < m; i++) {
+		u[i] = 0;
+		q[i] = 0;
+	}
+	u[m - 1] = 1 << ((64 + l) % 16);
+	i64_divmnu_(q, r, u, v, m, n);
+	for(i = n; i < 4; i++) {
+		r[i] = 0;
+	}
+	ret.magic_ = i64_fromDigits_(q);
+	rem = i64_fromDigits_(r);
+	ret.shift_ = l;
+
+	lowBit = i64_shiftLeft(I64_ONE, l);
+	if(i64_compareUnsigned(i64_subtract(ret.abs_, rem), lowBit) >= 0) {
+		/* the rounded-up reciprocal is not accurate enough
+			at 64 bits; use one more bit, and let
+			i64_divByDivisor add the 65th bit back in. */
+		ret.magic_ = i64_add(ret.magic_, ret.magic_);
+		twiceRem = i64_add(rem, rem);
+		if(i64_compareUnsigned(twiceRem, ret.abs_) >= 0
+				|| i64_compareUnsigned(twiceRem, rem) < 0) {
+			ret.magic_ = i64_add(ret.magic_, I64_ONE);
+		}
+		ret.flags_ |= I64_DIVISOR_ADD_;
+	}
+	ret.magic_ = i64_add(ret.magic_, I64_ONE);
+	return ret;
+}
+
+/* Unsigned division of 'this' by the magnitude of 'd'. */
+I64_API i64 i64_divByDivisorUnsigned_(i64 this, const i64_divisor *d) {
+	i64 q;
+
+	if(d->flags_ & I64_DIVISOR_POW2_) {
+		return i64_shiftRightUnsigned(this, d->shift_);
+	}
+	if((d->flags_ & I64_DIVISOR_SMALL_) && this.high_ == 0) {
+		return i64_fromBits((u32)this.low_ / (u32)d->abs_.low_, 0);
+	}
+
+	q = i64_multiplyHighUnsigned(d->magic_, this);
+	if(d->flags_ & I64_DIVISOR_ADD_) {
+		/* (this + q) / 2, without overflowing 64 bits. */
+		q = i64_add(
+			i64_shiftRightUnsigned(i64_subtract(this, q), 1), q);
+	}
+	return i64_shiftRightUnsigned(q, d->shift_);
+}
+
+/*
+	Returns this / d, like i64_div(this, divisor).
+*/
+I64_API i64 i64_divByDivisor(i64 this, const i64_divisor *d) {
+	i64 quot;
+	int thisNeg = i64_isNegative(this);
+
+	quot = i64_divByDivisorUnsigned_(
+		thisNeg ? i64_negate(this) : this, d);
+	return (thisNeg != ((d->flags_ & I64_DIVISOR_NEG_) != 0)) ?
+		i64_negate(quot) : quot;
+}
+
+/*
+	Returns this % d, like i64_modulo(this, divisor).
+*/
+I64_API i64 i64_modByDivisor(i64 this, const i64_divisor *d) {
+	return i64_subtract(this,
+		i64_multiply(i64_divByDivisor(this, d), d->divisor_));
+}
+
+/*
+	ARRAY OPERATIONS
+	================
+	Each operation applied elementwise over 'n' i64s, writing
+	to 'out'. The pointers are restrict-qualified, so 'out'
+	must not overlap the inputs.
+	
+	The loop bodies do word-at-a-time arithmetic on u32s,
+	with no calls or branches where possible, so that the
+	compiler is free to unroll and vectorize them.
+*/
+
+I64_API void i64_addArray(i64 *I64_RESTRICT out, const i64 *I64_RESTRICT a,
+		const i64 *I64_RESTRICT b, size_t n) {
+	size_t i;
+	u32 low;
+	for(i = 0; i < n; i++) {
+		low = (u32)a[i].low_ + (u32)b[i].low_;
+		out[i].high_ = (u32)a[i].high_ + (u32)b[i].high_
+			+ (low < (u32)a[i].low_);
+		out[i].low_ = low;
+	}
+}
+
+I64_API void i64_subtractArray(i64 *I64_RESTRICT out, const i64 *I64_RESTRICT a,
+		const i64 *I64_RESTRICT b, size_t n) {
+	size_t i;
+	u32 low;
+	for(i = 0; i < n; i++) {
+		low = (u32)a[i].low_ - (u32)b[i].low_;
+		out[i].high_ = (u32)a[i].high_ - (u32)b[i].high_
+			- ((u32)a[i].low_ < (u32)b[i].low_);
+		out[i].low_ = low;
+	}
+}
+
+I64_API void i64_multiplyArray(i64 *I64_RESTRICT out, const i64 *I64_RESTRICT a,
+		const i64 *I64_RESTRICT b, size_t n) {
+	size_t i;
+	for(i = 0; i < n; i++) {
+		out[i] = i64_multiply(a[i], b[i]);
+	}
+}
+
+I64_API void i64_negateArray(i64 *I64_RESTRICT out, const i64 *I64_RESTRICT a,
+		size_t n) {
+	size_t i;
+	u32 low;
+	for(i = 0; i < n; i++) {
+		low = 0 - (u32)a[i].low_;
+		out[i].high_ = 0 - (u32)a[i].high_ - (low != 0);
+		out[i].low_ = low;
+	}
+}
+
+I64_API void i64_andArray(i64 *I64_RESTRICT out, const i64 *I64_RESTRICT a,
+		const i64 *I64_RESTRICT b, size_t n) {
+	size_t i;
+	for(i = 0; i < n; i++) {
+		out[i].low_ = a[i].low_ & b[i].low_;
+		out[i].high_ = a[i].high_ & b[i].high_;
+	}
+}
+
+I64_API void i64_orArray(i64 *I64_RESTRICT out, const i64 *I64_RESTRICT a,
+		const i64 *I64_RESTRICT b, size_t n) {
+	size_t i;
+	for(i = 0; i < n; i++) {
+		out[i].low_ = a[i].low_ | b[i].low_;
+		out[i].high_ = a[i].high_ | b[i].high_;
+	}
+}
+
+I64_API void i64_xorArray(i64 *I64_RESTRICT out, const i64 *I64_RESTRICT a,
+		const i64 *I64_RESTRICT b, size_t n) {
+	size_t i;
+	for(i = 0; i < n; i++) {
+		out[i].low_ = a[i].low_ ^ b[i].low_;
+		out[i].high_ = a[i].high_ ^ b[i].high_;
+	}
+}
+
+I64_API void i64_notArray(i64 *I64_RESTRICT out, const i64 *I64_RESTRICT a,
+		size_t n) {
+	size_t i;
+	for(i = 0; i < n; i++) {
+		out[i].low_ = ~a[i].low_;
+		out[i].high_ = ~a[i].high_;
+	}
+}
+
+/*
+	Shifts every element by the same 'numBits', which we
+	normalize once, as the scalar shifts do on every call,
+	so that the loops themselves do not branch.
+*/
+
+I64_API void i64_shiftRightArray(i64 *I64_RESTRICT out,
+		const i64 *I64_RESTRICT a, i32 numBits, size_t n);
+	/* Forward ref. needed for left and right
+		shift to call each other as needed */
+
+I64_API void i64_shiftLeftArray(i64 *I64_RESTRICT out,
+		const i64 *I64_RESTRICT a, i32 numBits, size_t n) {
+	size_t i;
+	if(numBits < 0) {
+		i64_shiftRightArray(out, a, -numBits, n);
+		return;
+	}
+	numBits &= 63;
+	if(numBits == 0) {
+		for(i = 0; i < n; i++) {
+			out[i] = a[i];
+		}
+	} else if(numBits < 32) {
+		for(i = 0; i < n; i++) {
+			out[i].high_ = ((u32)a[i].high_ << numBits)
+				| SHR32F0(a[i].low_, 32 - numBits);
+			out[i].low_ = (u32)a[i].low_ << numBits;
+		}
+	} else {
+		for(i = 0; i < n; i++) {
+			out[i].high_ = (u32)a[i].low_ << (numBits - 32);
+			out[i].low_ = 0;
+		}
+	}
+}
+
+I64_API void i64_shiftRightArray(i64 *I64_RESTRICT out,
+		const i64 *I64_RESTRICT a, i32 numBits, size_t n) {
+	size_t i;
+	if(numBits < 0) {
+		i64_shiftLeftArray(out, a, -numBits, n);
+		return;
+	}
+	numBits &= 63;
+	if(numBits == 0) {
+		for(i = 0; i < n; i++) {
+			out[i] = a[i];
+		}
+	} else if(numBits < 32) {
+		for(i = 0; i < n; i++) {
+			out[i].low_ = SHR32F0(a[i].low_, numBits)
+				| ((u32)a[i].high_ << (32 - numBits));
+			out[i].high_ = a[i].high_ >> numBits;
+		}
+	} else {
+		for(i = 0; i < n; i++) {
+			out[i].low_ = a[i].high_ >> (numBits - 32);
+			out[i].high_ = a[i].high_ >> 31;
+		}
+	}
+}
+
+I64_API void i64_shiftRightUnsignedArray(i64 *I64_RESTRICT out,
+		const i64 *I64_RESTRICT a, i32 numBits, size_t n) {
+	size_t i;
+	if(numBits < 0) {
+		i64_shiftLeftArray(out, a, -numBits, n);
+		return;
+	}
+	numBits &= 63;
+	if(numBits == 0) {
+		for(i = 0; i < n; i++) {
+			out[i] = a[i];
+		}
+	} else if(numBits < 32) {
+		for(i = 0; i < n; i++) {
+			out[i].low_ = SHR32F0(a[i].low_, numBits)
+				| ((u32)a[i].high_ << (32 - numBits));
+			out[i].high_ = SHR32F0(a[i].high_, numBits);
+		}
+	} else {
+		for(i = 0; i < n; i++) {
+			out[i].low_ = SHR32F0(a[i].high_, numBits - 32);
+			out[i].high_ = 0;
+		}
+	}
+}
+
+/*
+	Scalar-broadcast forms: 'b' is the same for every element.
+*/
+
+I64_API void i64_addScalarArray(i64 *I64_RESTRICT out,
+		const i64 *I64_RESTRICT a, i64 b, size_t n) {
+	size_t i;
+	u32 low;
+	for(i = 0; i < n; i++) {
+		low = (u32)a[i].low_ + (u32)b.low_;
+		out[i].high_ = (u32)a[i].high_ + (u32)b.high_
+			+ (low < (u32)b.low_);
+		out[i].low_ = low;
+	}
+}
+
+I64_API void i64_subtractScalarArray(i64 *I64_RESTRICT out,
+		const i64 *I64_RESTRICT a, i64 b, size_t n) {
+	size_t i;
+	u32 low;
+	for(i = 0; i < n; i++) {
+		low = (u32)a[i].low_ - (u32)b.low_;
+		out[i].high_ = (u32)a[i].high_ - (u32)b.high_
+			- ((u32)a[i].low_ < (u32)b.low_);
+		out[i].low_ = low;
+	}
+}
+
+I64_API void i64_multiplyScalarArray(i64 *I64_RESTRICT out,
+		const i64 *I64_RESTRICT a, i64 b, size_t n) {
+	size_t i;
+	for(i = 0; i < n; i++) {
+		out[i] = i64_multiply(a[i], b);
+	}
+}
+
+I64_API void i64_andScalarArray(i64 *I64_RESTRICT out,
+		const i64 *I64_RESTRICT a, i64 b, size_t n) {
+	size_t i;
+	for(i = 0; i < n; i++) {
+		out[i].low_ = a[i].low_ & b.low_;
+		out[i].high_ = a[i].high_ & b.high_;
+	}
+}
+
+I64_API void i64_orScalarArray(i64 *I64_RESTRICT out, const i64 *I64_RESTRICT a,
+		i64 b, size_t n) {
+	size_t i;
+	for(i = 0; i < n; i++) {
+		out[i].low_ = a[i].low_ | b.low_;
+		out[i].high_ = a[i].high_ | b.high_;
+	}
+}
+
+I64_API void i64_xorScalarArray(i64 *I64_RESTRICT out,
+		const i64 *I64_RESTRICT a, i64 b, size_t n) {
+	size_t i;
+	for(i = 0; i < n; i++) {
+		out[i].low_ = a[i].low_ ^ b.low_;
+		out[i].high_ = a[i].high_ ^ b.high_;
+	}
+}
+
+#endif
+
+/*
+	Comparison masks: bit (i % 8) of mask[i / 8] is set
+	where 'a[i] predicate b[i]' holds (or 'a[i] predicate b',
+	for the scalar-threshold form), for one of the predicates
+	below. ceil(n / 8) bytes are written; the unused high
+	bits of the last byte are 0.
+	
+	Each predicate is built from a less-than bit, an
+	equals bit, and whether to invert the result.
+*/
+
+#define I64_CMP_LT_BIT_ 1
+#define I64_CMP_EQ_BIT_ 2
+#define I64_CMP_INVERT_BIT_ 4
+
+#define I64_CMP_LT 1 /* LT */
+#define I64_CMP_LE 3 /* LT | EQ */
+#define I64_CMP_GT 7 /* !(LT | EQ) */
+#define I64_CMP_GE 5 /* !LT */
+#define I64_CMP_EQ 2 /* EQ */
+#define I64_CMP_NE 6 /* !EQ */
+
+#ifdef I64_DEFINE_
+/* One predicate bit, with no branches. */
+#define I64_CMP_BIT_(a, b, ltMask, eqMask, invert) \
+	(((i64_lessThan(a, b) & (ltMask)) | (i64_equals(a, b) & (eqMask))) \
+		^ (invert))
+
+I64_API void i64_compareArrayToMask(const i64 *I64_RESTRICT a,
+		const i64 *I64_RESTRICT b, size_t n, int predicate,
+		unsigned char *I64_RESTRICT mask) {
+	int ltMask = (predicate & I64_CMP_LT_BIT_) != 0;
+	int eqMask = (predicate & I64_CMP_EQ_BIT_) != 0;
+	int invert = (predicate & I64_CMP_INVERT_BIT_) != 0;
+	size_t i, j;
+	unsigned int byte;
+
+	for(i = 0; i + 8 <= n; i += 8) {
+		byte = 0;
+		for(j = 0; j < 8; j++) {
+			byte |= I64_CMP_BIT_(a[i + j], b[i + j], ltMask, eqMask, invert)
+				<< j;
+		}
+		mask[i / 8] = (unsigned char)byte;
+	}
+	if(i < n) {
+		byte = 0;
+		for(j = 0; i + j < n; j++) {
+			byte |= I64_CMP_BIT_(a[i + j], b[i + j], ltMask, eqMask, invert)
+				<< j;
+		}
+		mask[i / 8] = (unsigned char)byte;
+	}
+}
+
+I64_API void i64_compareScalarArrayToMask(const i64 *I64_RESTRICT a, i64 b,
+		size_t n, int predicate, unsigned char *I64_RESTRICT mask) {
+	int ltMask = (predicate & I64_CMP_LT_BIT_) != 0;
+	int eqMask = (predicate & I64_CMP_EQ_BIT_) != 0;
+	int invert = (predicate & I64_CMP_INVERT_BIT_) != 0;
+	size_t i, j;
+	unsigned int byte;
+
+	for(i = 0; i + 8 <= n; i += 8) {
+		byte = 0;
+		for(j = 0; j < 8; j++) {
+			byte |= I64_CMP_BIT_(a[i + j], b, ltMask, eqMask, invert) << j;
+		}
+		mask[i / 8] = (unsigned char)byte;
+	}
+	if(i < n) {
+		byte = 0;
+		for(j = 0; i + j < n; j++) {
+			byte |= I64_CMP_BIT_(a[i + j], b, ltMask, eqMask, invert) << j;
+		}
+		mask[i / 8] = (unsigned char)byte;
+	}
+}
+
+/*
+	Selection vectors: the filters below write the indices
+	of the elements of 'a' that satisfy a predicate to 'sel',
+	in increasing order, and return how many they wrote.
+	'sel' must have room for n indices (and n must fit in a
+	u32). Every index is written, and then kept -- by
+	advancing the count -- only if its element matched, so
+	the loops have no branch on the data.
+*/
+
+/* Selects the elements in [lo, hi). */
+I64_API size_t i64_filterRange(const i64 *I64_RESTRICT a, size_t n, i64 lo,
+		i64 hi, u32 *I64_RESTRICT sel) {
+	size_t i, count = 0;
+	for(i = 0; i < n; i++) {
+		sel[count] = (u32)i;
+		count += i64_greaterThanOrEqual(a[i], lo) & i64_lessThan(a[i], hi);
+	}
+	return count;
+}
+
+/* Selects the elements equal to 'value'. */
+I64_API size_t i64_filterEquals(const i64 *I64_RESTRICT a, size_t n, i64 value,
+		u32 *I64_RESTRICT sel) {
+	size_t i, count = 0;
+	for(i = 0; i < n; i++) {
+		sel[count] = (u32)i;
+		count += i64_equals(a[i], value);
+	}
+	return count;
+}
+
+/* Selects the elements not equal to 'value'. */
+I64_API size_t i64_filterNotEquals(const i64 *I64_RESTRICT a, size_t n,
+		i64 value, u32 *I64_RESTRICT sel) {
+	size_t i, count = 0;
+	for(i = 0; i < n; i++) {
+		sel[count] = (u32)i;
+		count += !i64_equals(a[i], value);
+	}
+	return count;
+}
+
+#endif
+
+/*
+	STRUCTURE-OF-ARRAYS COLUMNS
+	===========================
+	An i64_soa is a column of 'length' i64s stored as two
+	separate arrays of words, rather than as an array of
+	interleaved i64 structs, so that a loop reads each half
+	with unit stride. The caller owns 'low' and 'high'.
+	
+	Operations run over the 'length' of their first input;
+	the other inputs and the output must be at least as long,
+	and the output arrays must not overlap the inputs.
+*/
+typedef struct {
+	i32 *low;
+	i32 *high;
+	size_t length;
+} i64_soa;
+
+#ifdef I64_DEFINE_
+/* Scatters the first column->length elements of 'in'. */
+I64_API void i64_soaFromArray(const i64_soa *column,
+		const i64 *I64_RESTRICT in) {
+	i32 *I64_RESTRICT low = column->low;
+	i32 *I64_RESTRICT high = column->high;
+	size_t i;
+	for(i = 0; i < column->length; i++) {
+		low[i] = in[i].low_;
+		high[i] = in[i].high_;
+	}
+}
+
+/* Gathers all of 'column' into 'out'. */
+I64_API void i64_soaToArray(i64 *I64_RESTRICT out, const i64_soa *column) {
+	const i32 *I64_RESTRICT low = column->low;
+	const i32 *I64_RESTRICT high = column->high;
+	size_t i;
+	for(i = 0; i < column->length; i++) {
+		out[i].low_ = low[i];
+		out[i].high_ = high[i];
+	}
+}
+
+I64_API void i64_soaAdd(const i64_soa *out, const i64_soa *a,
+		const i64_soa *b) {
+	i32 *I64_RESTRICT ol = out->low, *I64_RESTRICT oh = out->high;
+	const i32 *I64_RESTRICT al = a->low, *I64_RESTRICT ah = a->high;
+	const i32 *I64_RESTRICT bl = b->low, *I64_RESTRICT bh = b->high;
+	size_t i;
+	u32 low;
+	for(i = 0; i < a->length; i++) {
+		low = (u32)al[i] + (u32)bl[i];
+		oh[i] = (u32)ah[i] + (u32)bh[i] + (low < (u32)al[i]);
+		ol[i] = low;
+	}
+}
+
+I64_API void i64_soaSubtract(const i64_soa *out, const i64_soa *a,
+		const i64_soa *b) {
+	i32 *I64_RESTRICT ol = out->low, *I64_RESTRICT oh = out->high;
+	const i32 *I64_RESTRICT al = a->low, *I64_RESTRICT ah = a->high;
+	const i32 *I64_RESTRICT bl = b->low, *I64_RESTRICT bh = b->high;
+	size_t i;
+	for(i = 0; i < a->length; i++) {
+		oh[i] = (u32)ah[i] - (u32)bh[i] - ((u32)al[i] < (u32)bl[i]);
+		ol[i] = (u32)al[i] - (u32)bl[i];
+	}
+}
+
+/*
+	Writes i64_compare(a[i], b[i]) to out[i]: the signed
+	comparison of the high words decides, unless they are
+	equal, when the unsigned comparison of the low words does.
+	Both are computed, and selected between with a mask.
+*/
+I64_API void i64_soaCompare(int *I64_RESTRICT out, const i64_soa *a,
+		const i64_soa *b) {
+	const i32 *I64_RESTRICT al = a->low, *I64_RESTRICT ah = a->high;
+	const i32 *I64_RESTRICT bl = b->low, *I64_RESTRICT bh = b->high;
+	size_t i;
+	int highCmp, lowCmp;
+	for(i = 0; i < a->length; i++) {
+		highCmp = (ah[i] > bh[i]) - (ah[i] < bh[i]);
+		lowCmp = ((u32)al[i] > (u32)bl[i]) - ((u32)al[i] < (u32)bl[i]);
+		out[i] = highCmp | (lowCmp & -(highCmp == 0));
+	}
+}
+
+I64_API void i64_soaAnd(const i64_soa *out, const i64_soa *a,
+		const i64_soa *b) {
+	i32 *I64_RESTRICT ol = out->low, *I64_RESTRICT oh = out->high;
+	const i32 *I64_RESTRICT al = a->low, *I64_RESTRICT ah = a->high;
+	const i32 *I64_RESTRICT bl = b->low, *I64_RESTRICT bh = b->high;
+	size_t i;
+	for(i = 0; i < a->length; i++) {
+		ol[i] = al[i] & bl[i];
+		oh[i] = ah[i] & bh[i];
+	}
+}
+
+I64_API void i64_soaOr(const i64_soa *out, const i64_soa *a, const i64_soa *b) {
+	i32 *I64_RESTRICT ol = out->low, *I64_RESTRICT oh = out->high;
+	const i32 *I64_RESTRICT al = a->low, *I64_RESTRICT ah = a->high;
+	const i32 *I64_RESTRICT bl = b->low, *I64_RESTRICT bh = b->high;
+	size_t i;
+	for(i = 0; i < a->length; i++) {
+		ol[i] = al[i] | bl[i];
+		oh[i] = ah[i] | bh[i];
+	}
+}
+
+I64_API void i64_soaXor(const i64_soa *out, const i64_soa *a,
+		const i64_soa *b) {
+	i32 *I64_RESTRICT ol = out->low, *I64_RESTRICT oh = out->high;
+	const i32 *I64_RESTRICT al = a->low, *I64_RESTRICT ah = a->high;
+	const i32 *I64_RESTRICT bl = b->low, *I64_RESTRICT bh = b->high;
+	size_t i;
+	for(i = 0; i < a->length; i++) {
+		ol[i] = al[i] ^ bl[i];
+		oh[i] = ah[i] ^ bh[i];
+	}
+}
+
+I64_API void i64_soaNot(const i64_soa *out, const i64_soa *a) {
+	i32 *I64_RESTRICT ol = out->low, *I64_RESTRICT oh = out->high;
+	const i32 *I64_RESTRICT al = a->low, *I64_RESTRICT ah = a->high;
+	size_t i;
+	for(i = 0; i < a->length; i++) {
+		ol[i] = ~al[i];
+		oh[i] = ~ah[i];
+	}
+}
+
+/*
+	As with the array shifts, we normalize 'numBits' once,
+	outside the loops.
+*/
+
+I64_API void i64_soaShiftRight(const i64_soa *out, const i64_soa *a,
+		i32 numBits);
+	/* Forward ref. needed for left and right
+		shift to call each other as needed */
+
+I64_API void i64_soaShiftLeft(const i64_soa *out, const i64_soa *a,
+		i32 numBits) {
+	i32 *I64_RESTRICT ol = out->low, *I64_RESTRICT oh = out->high;
+	const i32 *I64_RESTRICT al = a->low, *I64_RESTRICT ah = a->high;
+	size_t i;
+	if(numBits < 0) {
+		i64_soaShiftRight(out, a, -numBits);
+		return;
+	}
+	numBits &= 63;
+	if(numBits == 0) {
+		for(i = 0; i < a->length; i++) {
+			ol[i] = al[i];
+			oh[i] = ah[i];
+		}
+	} else if(numBits < 32) {
+		for(i = 0; i < a->length; i++) {
+			oh[i] = ((u32)ah[i] << numBits) | SHR32F0(al[i], 32 - numBits);
+			ol[i] = (u32)al[i] << numBits;
+		}
+	} else {
+		for(i = 0; i < a->length; i++) {
+			oh[i] = (u32)al[i] << (numBits - 32);
+			ol[i] = 0;
+		}
+	}
+}
+
+I64_API void i64_soaShiftRight(const i64_soa *out, const i64_soa *a,
+		i32 numBits) {
+	i32 *I64_RESTRICT ol = out->low, *I64_RESTRICT oh = out->high;
+	const i32 *I64_RESTRICT al = a->low, *I64_RESTRICT ah = a->high;
+	size_t i;
+	if(numBits < 0) {
+		i64_soaShiftLeft(out, a, -numBits);
+		return;
+	}
+	numBits &= 63;
+	if(numBits == 0) {
+		for(i = 0; i < a->length; i++) {
+			ol[i] = al[i];
+			oh[i] = ah[i];
+		}
+	} else if(numBits < 32) {
+		for(i = 0; i < a->length; i++) {
+			ol[i] = SHR32F0(al[i], numBits) | ((u32)ah[i] << (32 - numBits));
+			oh[i] = ah[i] >> numBits;
+		}
+	} else {
+		for(i = 0; i < a->length; i++) {
+			ol[i] = ah[i] >> (numBits - 32);
+			oh[i] = ah[i] >> 31;
+		}
+	}
+}
+
+I64_API void i64_soaShiftRightUnsigned(const i64_soa *out, const i64_soa *a,
+		i32 numBits) {
+	i32 *I64_RESTRICT ol = out->low, *I64_RESTRICT oh = out->high;
+	const i32 *I64_RESTRICT al = a->low, *I64_RESTRICT ah = a->high;
+	size_t i;
+	if(numBits < 0) {
+		i64_soaShiftLeft(out, a, -numBits);
+		return;
+	}
+	numBits &= 63;
+	if(numBits == 0) {
+		for(i = 0; i < a->length; i++) {
+			ol[i] = al[i];
+			oh[i] = ah[i];
+		}
+	} else if(numBits < 32) {
+		for(i = 0; i < a->length; i++) {
+			ol[i] = SHR32F0(al[i], numBits) | ((u32)ah[i] << (32 - numBits));
+			oh[i] = SHR32F0(ah[i], numBits);
+		}
+	} else {
+		for(i = 0; i < a->length; i++) {
+			ol[i] = SHR32F0(ah[i], numBits - 32);
+			oh[i] = 0;
+		}
+	}
+}
+
+/*
+	BULK TEXT
+	=========
+	Parsing whole buffers of delimited decimal fields (one
+	value per line, or comma-separated, etc.) in place:
+	no copies, and no NUL terminators. The fields are found
+	a word at a time and parsed with i64_fromString's
+	decimal logic.
+	
+	A field is an optional '-' and decimal digits, in the
+	range of an i64. When 'delim' is '\n', a '\r' at the end
+	of a field is ignored, for CRLF text. A delimiter at the
+	very end of the input does not start another field,
+	but empty fields elsewhere are malformed.
+*/
+
+#endif
+
+/*
+	Where a call stopped: at the first malformed field (with
+	its I64_TOFROMSTR_* status), or because 'out' was full
+	(I64_TOFROMSTR_FAIL_LENGTH). 'offset' is the offset of
+	that field from the start of the stream -- just the
+	start of the buffer, for i64_parseBuffer -- and
+	'consumed' is how many bytes of the buffer were used.
+	After a malformed field, 'consumed' is past the field,
+	so calling again on the rest of the buffer skips it;
+	when 'out' is full, it is the start of the next field.
+	With no error, 'status' is I64_TOFROMSTR_SUCC and
+	'offset' is where the parsing stopped.
+*/
+typedef struct {
+	int status;
+	size_t offset;
+	size_t consumed;
+} i64_parse_error;
+
+#define I64_PARSE_CARRY_ 64
+	/* the longest field that can span two buffers */
+
+/*
+	The state of a parse that continues across buffers
+	(i64_parseStream): the start of a field that ran off
+	the end of the last buffer, and how far into the
+	stream we are. Initialize with i64_initParseState.
+	Leading zeros are not carried, so any field parses the
+	same however the buffers split it: one with more than
+	I64_PARSE_CARRY_ significant characters is out of range,
+	or malformed if it is not all digits.
+*/
+typedef struct {
+	char carry_[I64_PARSE_CARRY_];
+	size_t carryLen_;
+	size_t carryOffset_;
+	size_t carryNonDigits_;
+		/* characters of the magnitude that are not digits */
+	char carryLast_;
+		/* the last character of the field so far */
+	int pending_;
+		/* a field is being carried over */
+	size_t position_;
+		/* the stream offset of the next buffer */
+} i64_parse_state;
+
+#ifdef I64_DEFINE_
+I64_API void i64_initParseState(i64_parse_state *state) {
+	state->carryLen_ = 0;
+	state->carryNonDigits_ = 0;
+	state->carryLast_ = 0;
+	state->carryOffset_ = 0;
+	state->pending_ = 0;
+	state->position_ = 0;
+}
+
+/*
+	The index of the first 'delim' in buf[from, len), or
+	'len' if there is none. We test four bytes at once:
+	after xoring with the delimiter, a zero byte is a match,
+	and (x - 0x01010101) & ~x has the top bit of the lowest
+	zero byte set (and of no byte below it).
+*/
+I64_API size_t i64_findByte_(const char *buf, size_t from, size_t len,
+		char delim) {
+	u32 pattern = (u32)(unsigned char)delim * 0x01010101, x;
+	for(; from + 4 <= len; from += 4) {
+		x = I64_LOAD4_(buf + from) ^ pattern;
+		x = (x - 0x01010101) & ~x & 0x80808080;
+		if(x != 0) {
+			return from + (i64_ctz32_(x) >> 3);
+		}
+	}
+	while(from < len && buf[from] != delim) {
+		from++;
+	}
+	return from;
+}
+
+/* Parses the field [str, str + len) into '*out'. */
+I64_API int i64_parseField_(const char *str, size_t len, char delim, i64 *out) {
+	size_t neg, i;
+	int status;
+
+	if(delim == '\n' && len > 0 && str[len - 1] == '\r') {
+		len--;
+	}
+	neg = len > 0 && str[0] == '-';
+	if(len - neg > 0x7FFF) {
+		/* far too long, but is it a number? */
+		for(i = neg; i < len; i++) {
+			if((u32)(unsigned char)str[i] - '0' >= 10) {
+				return I64_TOFROMSTR_FAIL_DIGIT;
+			}
+		}
+		return I64_TOFROMSTR_FAIL_RANGE;
+	}
+	status = i64_parseMagnitude_(10, str + neg, (int)(len - neg),
+		neg ? I64_MIN : I64_MAX, out);
+	if(status == I64_TOFROMSTR_SUCC && neg) {
+		*out = i64_negate(*out);
+	}
+	return status;
+}
+
+/*
+	Appends to the field being carried over. A leading zero
+	is overwritten by the digit after it, so that carryLen_
+	counts only the significant characters; past
+	I64_PARSE_CARRY_ of them, we just count the non-digits.
+*/
+I64_API void i64_carryField_(i64_parse_state *state, const char *str,
+		size_t len, size_t offset) {
+	size_t i, sign;
+	int digit;
+	if(!state->pending_) {
+		state->pending_ = 1;
+		state->carryLen_ = 0;
+		state->carryOffset_ = offset;
+		state->carryNonDigits_ = 0;
+	}
+	for(i = 0; i < len; i++) {
+		state->carryLast_ = str[i];
+		if(state->carryLen_ == 0 && str[i] == '-') {
+			state->carry_[state->carryLen_++] = '-';
+			continue;
+		}
+		digit = (u32)(unsigned char)str[i] - '0' < 10;
+		state->carryNonDigits_ += !digit;
+		sign = state->carryLen_ > 0 && state->carry_[0] == '-';
+		if(digit && state->carryLen_ == sign + 1
+				&& state->carry_[sign] == '0') {
+			state->carry_[sign] = str[i];
+		} else {
+			if(state->carryLen_ < I64_PARSE_CARRY_) {
+				state->carry_[state->carryLen_] = str[i];
+			}
+			state->carryLen_++;
+		}
+	}
+}
+
+/*
+	Parses the field carried over, or classifies it as
+	i64_parseField_ would if it is too long to keep: its
+	digits could not be in range (a '\r' before a '\n'
+	delimiter aside).
+*/
+I64_API int i64_parseCarried_(i64_parse_state *state, char delim, i64 *out) {
+	if(state->carryLen_ <= I64_PARSE_CARRY_) {
+		return i64_parseField_(state->carry_, state->carryLen_, delim, out);
+	}
+	if(state->carryNonDigits_ == 0 || (state->carryNonDigits_ == 1
+			&& delim == '\n' && state->carryLast_ == '\r')) {
+		return I64_TOFROMSTR_FAIL_RANGE;
+	}
+	return I64_TOFROMSTR_FAIL_DIGIT;
+}
+
+/*
+	Parses the fields of 'buf', the next 'len' bytes of a
+	stream, into 'out' (which has room for 'cap' values),
+	and returns how many it parsed. A field left unfinished
+	at the end of 'buf' is carried over to the next call,
+	unless 'final' is set, when the end of 'buf' ends it.
+	'err', if not NULL, gets where we stopped.
+*/
+I64_API size_t i64_parseStream(i64_parse_state *state,
+		const char *buf, size_t len, char delim, int final, i64 *out,
+		size_t cap, i64_parse_error *err) {
+	size_t count = 0, start = 0, end, fieldOffset = 0;
+	int status = I64_TOFROMSTR_SUCC;
+
+	while(start < len || (final && state->pending_)) {
+		end = i64_findByte_(buf, start, len, delim);
+		if(end == len && !final) {
+			i64_carryField_(state, buf + start, len - start,
+				state->position_ + start);
+			start = len;
+			break;
+		}
+		if(count == cap) {
+			status = I64_TOFROMSTR_FAIL_LENGTH;
+			fieldOffset = state->pending_ ? state->carryOffset_
+				: state->position_ + start;
+			break;
+		}
+		if(state->pending_) {
+			i64_carryField_(state, buf + start, end - start, 0);
+			status = i64_parseCarried_(state, delim, out + count);
+			fieldOffset = state->carryOffset_;
+			state->pending_ = 0;
+		} else {
+			status = i64_parseField_(buf + start, end - start, delim,
+				out + count);
+			fieldOffset = state->position_ + start;
+		}
+		start = end + (end < len);
+		if(status != I64_TOFROMSTR_SUCC) {
+			break;
+		}
+		count++;
+	}
+
+	state->position_ += start;
+	if(err != NULL) {
+		err->status = status;
+		err->offset = (status == I64_TOFROMSTR_SUCC)
+			? state->position_ : fieldOffset;
+		err->consumed = start;
+	}
+	return count;
+}
+
+/*
+	Parses all of the fields of 'buf' into 'out' (which has
+	room for 'cap' values), and returns how many it parsed.
+	'err', if not NULL, gets where we stopped.
+*/
+I64_API size_t i64_parseBuffer(const char *buf, size_t len, char delim,
+		i64 *out, size_t cap, i64_parse_error *err) {
+	i64_parse_state state;
+	i64_initParseState(&state);
+	return i64_parseStream(&state, buf, len, delim, 1, out, cap, err);
+}
+
+/*
+	Formatting whole arrays: we size each value exactly
+	before writing it, so that its digits can be written
+	straight into place, backwards, as i64_toString does.
+	
+	The number of decimal digits of x is floor(log10(x)) + 1,
+	and log10(x) is within one of log10(2) * log2(x), which
+	1233 / 4096 approximates closely enough for 64 bits;
+	comparing with the next power of ten settles which.
+*/
+
+static const i64 I64_POWERS_OF_TEN_[20] = {
+	I64_INIT(0x00000000, 0x00000001), /* 10^0 */
+	I64_INIT(0x00000000, 0x0000000A), /* 10^1 */
+	I64_INIT(0x00000000, 0x00000064), /* 10^2 */
+	I64_INIT(0x00000000, 0x000003E8), /* 10^3 */
+	I64_INIT(0x00000000, 0x00002710), /* 10^4 */
+	I64_INIT(0x00000000, 0x000186A0), /* 10^5 */
+	I64_INIT(0x00000000, 0x000F4240), /* 10^6 */
+	I64_INIT(0x00000000, 0x00989680), /* 10^7 */
+	I64_INIT(0x00000000, 0x05F5E100), /* 10^8 */
+	I64_INIT(0x00000000, 0x3B9ACA00), /* 10^9 */
+	I64_INIT(0x00000002, 0x540BE400), /* 10^10 */
+	I64_INIT(0x00000017, 0x4876E800), /* 10^11 */
+	I64_INIT(0x000000E8, 0xD4A51000), /* 10^12 */
+	I64_INIT(0x00000918, 0x4E72A000), /* 10^13 */
+	I64_INIT(0x00005AF3, 0x107A4000), /* 10^14 */
+	I64_INIT(0x00038D7E, 0xA4C68000), /* 10^15 */
+	I64_INIT(0x002386F2, 0x6FC10000), /* 10^16 */
+	I64_INIT(0x01634578, 0x5D8A0000), /* 10^17 */
+	I64_INIT(0x0DE0B6B3, 0xA7640000), /* 10^18 */
+	I64_INIT(0x8AC72304, 0x89E80000)  /* 10^19 */
+};
+
+/* The number of decimal digits of 'this', read as unsigned. */
+I64_API int i64_countDigits_(i64 this) {
+	i64 atLeastOne = i64_or(this, I64_ONE);
+	int digits = ((64 - i64_numberOfLeadingZeros(atLeastOne)) * 1233) >> 12;
+	return digits + (i64_compareUnsigned(atLeastOne,
+		I64_POWERS_OF_TEN_[digits]) >= 0);
+}
+
+/* The length of i64_toString(this, 10, ...), without the NUL. */
+I64_API int i64_decimalLength(i64 this) {
+	return i64_isNegative(this)
+		? 1 + i64_countDigits_(i64_negate(this))
+		: i64_countDigits_(this);
+}
+
+#endif
+
+/*
+	How far i64_formatArray got: 'written' bytes of output,
+	for the first 'count' values. If 'count' is less than
+	the number of values, 'out' ran out of room, and the
+	call can be resumed from there.
+*/
+typedef struct {
+	size_t written;
+	size_t count;
+} i64_format_result;
+
+#ifdef I64_DEFINE_
+/*
+	Writes the n values at 'vals' to 'out' (which has room
+	for 'cap' bytes) in decimal, each followed by 'delim' --
+	so that a resumed call carries straight on, and the
+	output is what i64_parseBuffer reads. No NUL is written.
+*/
+I64_API i64_format_result i64_formatArray(const i64 *vals, size_t n, char delim,
+		char *out, size_t cap) {
+	i64_format_result ret;
+	size_t length;
+	i64 magnitude;
+	int neg;
+
+	ret.written = 0;
+	for(ret.count = 0; ret.count < n; ret.count++) {
+		neg = i64_isNegative(vals[ret.count]);
+		magnitude = neg ? i64_negate(vals[ret.count]) : vals[ret.count];
+		length = neg + i64_countDigits_(magnitude);
+		if(cap - ret.written < length + 1) {
+			break;
+		}
+		i64_putUnsigned_(out + ret.written + length, magnitude, 10);
+		if(neg) {
+			out[ret.written] = '-';
+		}
+		out[ret.written + length] = delim;
+		ret.written += length + 1;
+	}
+	return ret;
+}
+
+#endif /* I64_DEFINE_ */
+
+#ifndef I64_DEFINE_
+/*
+	DECLARATIONS
+	============
+	With I64_EXTERN, outside the I64_IMPLEMENTATION file,
+	the functions above are only declared.
+*/
+
+#ifdef I64_ENABLE_TRACE
+/* Tracing */
+I64_API void i64_setTraceHook(i64_traceHook hook);
+I64_API void i64_trace_(const char *format, ...);
+I64_API void i64_debugPrint(i64 this);
+I64_API void i64_debugPrintDecimal(i64 this);
+#endif
+
+/* Base definitions */
+I64_API i64 i64_fromBits(i32 low, i32 high);
+#ifdef I64_USE_NATIVE
+I64_API i64 i64_fromU64_(u64_native_ value);
+#endif
 
+/* Constants */
+I64_API i64 i64_getMinValue();
+I64_API i64 i64_getMaxValue();
+I64_API i64 i64_getZero();
+I64_API i64 i64_getOne();
+I64_API i64 i64_getNegOne();
+
+/* Comparisons */
+I64_API int i64_isZero(i64 this);
+I64_API int i64_isNegative(i64 this);
+I64_API int i64_isOdd(i64 this);
+I64_API int i64_compare(i64 this, i64 other);
+I64_API int i64_compareUnsigned(i64 this, i64 other);
+I64_API int i64_equals(i64 this, i64 other);
+I64_API int i64_notEquals(i64 this, i64 other);
+I64_API int i64_lessThan(i64 this, i64 other);
+I64_API int i64_lessThanOrEqual(i64 this, i64 other);
+I64_API int i64_greaterThan(i64 this, i64 other);
+I64_API int i64_greaterThanOrEqual(i64 this, i64 other);
+
+/* Arithmetic operations except division */
+I64_API i64 i64_negate(i64 this);
+I64_API i64 i64_add(i64 this, i64 other);
+I64_API i64 i64_subtract(i64 this, i64 other);
+I64_API i64 i64_multiply(i64 this, i64 other);
+
+/* Type conversions */
+I64_API i64 i64_fromInt(i32 intValue);
+I64_API i32 i64_toInt(i64 this);
+I64_API i64 i64_fromDouble(double value);
+I64_API double i64_toDouble(i64 this);
+I64_API void i64_toDoubleArray(double *I64_RESTRICT out,
+		const i64 *I64_RESTRICT a, size_t n);
+I64_API int i64_isSafeInteger(i64 this);
+
+/* String conversions */
+I64_API int i64_toString(i64 this, int radix, char *strOut, int outLen);
+I64_API int i64_toUnsignedString(i64 this, int radix, char *strOut,
+		int outLen);
+I64_API i64 i64_fromString(int radix, const char *strIn, int inLen,
+		int *outStatus);
+I64_API i64 i64_fromUnsignedString(int radix, const char *strIn, int inLen,
+		int *outStatus);
+
+/* Bitwise operations */
+I64_API i64 i64_not(i64 this);
+I64_API i64 i64_and(i64 this, i64 other);
+I64_API i64 i64_or(i64 this, i64 other);
+I64_API i64 i64_xor(i64 this, i64 other);
+I64_API i64 i64_shiftLeft(i64 this, i32 numBits);
+I64_API i64 i64_shiftRight(i64 this, i32 numBits);
+I64_API i64 i64_shiftRightUnsigned(i64 this, i32 numBits);
+I64_API i64 i64_rotateLeft(i64 this, i32 numBits);
+I64_API i64 i64_rotateRight(i64 this, i32 numBits);
+
+/* Bit scans */
+I64_API int i64_numberOfLeadingZeros(i64 this);
+I64_API int i64_numberOfTrailingZeros(i64 this);
+I64_API int i64_bitCount(i64 this);
+I64_API int i64_getNumBitsAbs(i64 this);
+
+/* Division */
+I64_API i64 i64_DivModUnsigned(i64 this, i64 other, i64 *rem);
+I64_API i64 i64_DivMod(i64 this, i64 other, i64 *rem);
+I64_API i64 i64_div(i64 this, i64 other);
+I64_API i64 i64_modulo(i64 this, i64 other);
+
+/* Widening multiplication */
+I64_API i64 i64_multiplyFullUnsigned(i64 this, i64 other, i64 *high);
+I64_API i64 i64_multiplyFull(i64 this, i64 other, i64 *high);
+I64_API i64 i64_multiplyHighUnsigned(i64 this, i64 other);
+I64_API i64 i64_multiplyHigh(i64 this, i64 other);
+
+/* Invariant divisors */
+I64_API i64_divisor i64_makeDivisor(i64 divisor);
+I64_API i64 i64_divByDivisor(i64 this, const i64_divisor *d);
+I64_API i64 i64_modByDivisor(i64 this, const i64_divisor *d);
+
+/* Array operations */
+I64_API void i64_addArray(i64 *I64_RESTRICT out, const i64 *I64_RESTRICT a,
+		const i64 *I64_RESTRICT b, size_t n);
+I64_API void i64_subtractArray(i64 *I64_RESTRICT out, const i64 *I64_RESTRICT a,
+		const i64 *I64_RESTRICT b, size_t n);
+I64_API void i64_multiplyArray(i64 *I64_RESTRICT out, const i64 *I64_RESTRICT a,
+		const i64 *I64_RESTRICT b, size_t n);
+I64_API void i64_negateArray(i64 *I64_RESTRICT out, const i64 *I64_RESTRICT a,
+		size_t n);
+I64_API void i64_andArray(i64 *I64_RESTRICT out, const i64 *I64_RESTRICT a,
+		const i64 *I64_RESTRICT b, size_t n);
+I64_API void i64_orArray(i64 *I64_RESTRICT out, const i64 *I64_RESTRICT a,
+		const i64 *I64_RESTRICT b, size_t n);
+I64_API void i64_xorArray(i64 *I64_RESTRICT out, const i64 *I64_RESTRICT a,
+		const i64 *I64_RESTRICT b, size_t n);
+I64_API void i64_notArray(i64 *I64_RESTRICT out, const i64 *I64_RESTRICT a,
+		size_t n);
+I64_API void i64_shiftLeftArray(i64 *I64_RESTRICT out,
+		const i64 *I64_RESTRICT a, i32 numBits, size_t n);
+I64_API void i64_shiftRightArray(i64 *I64_RESTRICT out,
+		const i64 *I64_RESTRICT a, i32 numBits, size_t n);
+I64_API void i64_shiftRightUnsignedArray(i64 *I64_RESTRICT out,
+		const i64 *I64_RESTRICT a, i32 numBits, size_t n);
+I64_API void i64_addScalarArray(i64 *I64_RESTRICT out,
+		const i64 *I64_RESTRICT a, i64 b, size_t n);
+I64_API void i64_subtractScalarArray(i64 *I64_RESTRICT out,
+		const i64 *I64_RESTRICT a, i64 b, size_t n);
+I64_API void i64_multiplyScalarArray(i64 *I64_RESTRICT out,
+		const i64 *I64_RESTRICT a, i64 b, size_t n);
+I64_API void i64_andScalarArray(i64 *I64_RESTRICT out,
+		const i64 *I64_RESTRICT a, i64 b, size_t n);
+I64_API void i64_orScalarArray(i64 *I64_RESTRICT out, const i64 *I64_RESTRICT a,
+		i64 b, size_t n);
+I64_API void i64_xorScalarArray(i64 *I64_RESTRICT out,
+		const i64 *I64_RESTRICT a, i64 b, size_t n);
+I64_API void i64_compareArrayToMask(const i64 *I64_RESTRICT a,
+		const i64 *I64_RESTRICT b, size_t n, int predicate,
+		unsigned char *I64_RESTRICT mask);
+I64_API void i64_compareScalarArrayToMask(const i64 *I64_RESTRICT a, i64 b,
+		size_t n, int predicate, unsigned char *I64_RESTRICT mask);
+I64_API size_t i64_filterRange(const i64 *I64_RESTRICT a, size_t n, i64 lo,
+		i64 hi, u32 *I64_RESTRICT sel);
+I64_API size_t i64_filterEquals(const i64 *I64_RESTRICT a, size_t n, i64 value,
+		u32 *I64_RESTRICT sel);
+I64_API size_t i64_filterNotEquals(const i64 *I64_RESTRICT a, size_t n,
+		i64 value, u32 *I64_RESTRICT sel);
+
+/* Structure-of-arrays columns */
+I64_API void i64_soaFromArray(const i64_soa *column,
+		const i64 *I64_RESTRICT in);
+I64_API void i64_soaToArray(i64 *I64_RESTRICT out, const i64_soa *column);
+I64_API void i64_soaAdd(const i64_soa *out, const i64_soa *a,
+		const i64_soa *b);
+I64_API void i64_soaSubtract(const i64_soa *out, const i64_soa *a,
+		const i64_soa *b);
+I64_API void i64_soaCompare(int *I64_RESTRICT out, const i64_soa *a,
+		const i64_soa *b);
+I64_API void i64_soaAnd(const i64_soa *out, const i64_soa *a,
+		const i64_soa *b);
+I64_API void i64_soaOr(const i64_soa *out, const i64_soa *a, const i64_soa *b);
+I64_API void i64_soaXor(const i64_soa *out, const i64_soa *a,
+		const i64_soa *b);
+I64_API void i64_soaNot(const i64_soa *out, const i64_soa *a);
+I64_API void i64_soaShiftLeft(const i64_soa *out, const i64_soa *a,
+		i32 numBits);
+I64_API void i64_soaShiftRight(const i64_soa *out, const i64_soa *a,
+		i32 numBits);
+I64_API void i64_soaShiftRightUnsigned(const i64_soa *out, const i64_soa *a,
+		i32 numBits);
+
+/* Bulk text */
+I64_API void i64_initParseState(i64_parse_state *state);
+I64_API size_t i64_parseStream(i64_parse_state *state,
+		const char *buf, size_t len, char delim, int final, i64 *out,
+		size_t cap, i64_parse_error *err);
+I64_API size_t i64_parseBuffer(const char *buf, size_t len, char delim,
+		i64 *out, size_t cap, i64_parse_error *err);
+I64_API int i64_decimalLength(i64 this);
+I64_API i64_format_result i64_formatArray(const i64 *vals, size_t n, char delim,
+		char *out, size_t cap);
+#endif /* I64_DEFINE_ */
 
 #endif
@@ -0,0 +1,1037 @@
+/*
+	i64_c89_simd.h
+
+	Optional SSE2 and AVX2 kernels for the array operations
+	of i64_c89.h, for x86 and x86-64 hosts. This header is
+	not C89 -- it needs the compiler's intrinsics -- which is
+	why it is kept apart from i64_c89.h.
+
+	Each kernel has the same contract as the scalar array
+	operation it is named after (i64_addArraySSE2 as
+	i64_addArray, etc.), and gives bit-identical results.
+	The SSE2 kernels need an SSE2 CPU (any x86-64), and the
+	AVX2 kernels an AVX2 CPU. With GCC and Clang both sets are
+	compiled regardless of -m flags, through target attributes,
+	so one binary can carry all of them; the dispatch table
+	at the end of this file picks the best the CPU supports.
+
+	Linkage follows i64_c89.h: see LINKAGE there.
+*/
+
+#ifndef I64_C89_SIMD_H
+#define I64_C89_SIMD_H
+
+#include "i64_c89.h"
+
+/* Kernel levels, in increasing order. */
+#define I64_SIMD_NONE 0
+	/* the portable loops of i64_c89.h */
+#define I64_SIMD_SSE2 1
+#define I64_SIMD_AVX2 2
+
+#if defined(__x86_64__) || defined(_M_X64) \
+		|| defined(__i386__) || defined(_M_IX86)
+	#define I64_SIMD_X86
+#endif
+
+#ifdef I64_SIMD_X86
+
+#include <immintrin.h>
+#if defined(_MSC_VER)
+	#include <intrin.h>
+#else
+	#include <cpuid.h>
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+	#define I64_TARGET_SSE2 __attribute__((target("sse2")))
+	#define I64_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+	#define I64_TARGET_SSE2
+	#define I64_TARGET_AVX2
+#endif
+
+/*
+	On x86, an i64 -- low word first, then high word -- is
+	laid out exactly as a little-endian 64-bit integer, so
+	an array of i64s can be loaded directly into 64-bit
+	vector lanes. Fail to compile if the struct is padded.
+*/
+typedef char i64_simdLayoutCheck_[sizeof(i64) == 8 ? 1 : -1];
+
+#ifdef I64_DEFINE_
+/*
+	ARRAY KERNELS
+	=============
+	With 64-bit lanes, the carry from low_ to high_ happens
+	inside the vector adder (paddq), so add, subtract and
+	negate need no carry handling of their own. Each kernel
+	finishes the last few elements with the scalar loop.
+*/
+
+#define I64_LOAD128_(p) _mm_loadu_si128((const __m128i *)(p))
+#define I64_STORE128_(p, v) _mm_storeu_si128((__m128i *)(p), (v))
+#define I64_LOAD256_(p) _mm256_loadu_si256((const __m256i *)(p))
+#define I64_STORE256_(p, v) _mm256_storeu_si256((__m256i *)(p), (v))
+
+I64_TARGET_SSE2
+I64_API void i64_addArraySSE2(i64 *I64_RESTRICT out, const i64 *I64_RESTRICT a,
+		const i64 *I64_RESTRICT b, size_t n) {
+	size_t i;
+	for(i = 0; i + 2 <= n; i += 2) {
+		I64_STORE128_(out + i,
+			_mm_add_epi64(I64_LOAD128_(a + i), I64_LOAD128_(b + i)));
+	}
+	i64_addArray(out + i, a + i, b + i, n - i);
+}
+
+I64_TARGET_SSE2
+I64_API void i64_subtractArraySSE2(i64 *I64_RESTRICT out,
+		const i64 *I64_RESTRICT a, const i64 *I64_RESTRICT b, size_t n) {
+	size_t i;
+	for(i = 0; i + 2 <= n; i += 2) {
+		I64_STORE128_(out + i,
+			_mm_sub_epi64(I64_LOAD128_(a + i), I64_LOAD128_(b + i)));
+	}
+	i64_subtractArray(out + i, a + i, b + i, n - i);
+}
+
+I64_TARGET_SSE2
+I64_API void i64_negateArraySSE2(i64 *I64_RESTRICT out,
+		const i64 *I64_RESTRICT a, size_t n) {
+	size_t i;
+	__m128i zero = _mm_setzero_si128();
+	for(i = 0; i + 2 <= n; i += 2) {
+		I64_STORE128_(out + i, _mm_sub_epi64(zero, I64_LOAD128_(a + i)));
+	}
+	i64_negateArray(out + i, a + i, n - i);
+}
+
+I64_TARGET_SSE2
+I64_API void i64_andArraySSE2(i64 *I64_RESTRICT out, const i64 *I64_RESTRICT a,
+		const i64 *I64_RESTRICT b, size_t n) {
+	size_t i;
+	for(i = 0; i + 2 <= n; i += 2) {
+		I64_STORE128_(out + i,
+			_mm_and_si128(I64_LOAD128_(a + i), I64_LOAD128_(b + i)));
+	}
+	i64_andArray(out + i, a + i, b + i, n - i);
+}
+
+I64_TARGET_SSE2
+I64_API void i64_orArraySSE2(i64 *I64_RESTRICT out, const i64 *I64_RESTRICT a,
+		const i64 *I64_RESTRICT b, size_t n) {
+	size_t i;
+	for(i = 0; i + 2 <= n; i += 2) {
+		I64_STORE128_(out + i,
+			_mm_or_si128(I64_LOAD128_(a + i), I64_LOAD128_(b + i)));
+	}
+	i64_orArray(out + i, a + i, b + i, n - i);
+}
+
+I64_TARGET_SSE2
+I64_API void i64_xorArraySSE2(i64 *I64_RESTRICT out, const i64 *I64_RESTRICT a,
+		const i64 *I64_RESTRICT b, size_t n) {
+	size_t i;
+	for(i = 0; i + 2 <= n; i += 2) {
+		I64_STORE128_(out + i,
+			_mm_xor_si128(I64_LOAD128_(a + i), I64_LOAD128_(b + i)));
+	}
+	i64_xorArray(out + i, a + i, b + i, n - i);
+}
+
+I64_TARGET_SSE2
+I64_API void i64_notArraySSE2(i64 *I64_RESTRICT out, const i64 *I64_RESTRICT a,
+		size_t n) {
+	size_t i;
+	__m128i ones = _mm_set1_epi32(-1);
+	for(i = 0; i + 2 <= n; i += 2) {
+		I64_STORE128_(out + i, _mm_xor_si128(I64_LOAD128_(a + i), ones));
+	}
+	i64_notArray(out + i, a + i, n - i);
+}
+
+I64_TARGET_AVX2
+I64_API void i64_addArrayAVX2(i64 *I64_RESTRICT out, const i64 *I64_RESTRICT a,
+		const i64 *I64_RESTRICT b, size_t n) {
+	size_t i;
+	for(i = 0; i + 4 <= n; i += 4) {
+		I64_STORE256_(out + i,
+			_mm256_add_epi64(I64_LOAD256_(a + i), I64_LOAD256_(b + i)));
+	}
+	i64_addArray(out + i, a + i, b + i, n - i);
+}
+
+I64_TARGET_AVX2
+I64_API void i64_subtractArrayAVX2(i64 *I64_RESTRICT out,
+		const i64 *I64_RESTRICT a, const i64 *I64_RESTRICT b, size_t n) {
+	size_t i;
+	for(i = 0; i + 4 <= n; i += 4) {
+		I64_STORE256_(out + i,
+			_mm256_sub_epi64(I64_LOAD256_(a + i), I64_LOAD256_(b + i)));
+	}
+	i64_subtractArray(out + i, a + i, b + i, n - i);
+}
+
+I64_TARGET_AVX2
+I64_API void i64_negateArrayAVX2(i64 *I64_RESTRICT out,
+		const i64 *I64_RESTRICT a, size_t n) {
+	size_t i;
+	__m256i zero = _mm256_setzero_si256();
+	for(i = 0; i + 4 <= n; i += 4) {
+		I64_STORE256_(out + i, _mm256_sub_epi64(zero, I64_LOAD256_(a + i)));
+	}
+	i64_negateArray(out + i, a + i, n - i);
+}
+
+I64_TARGET_AVX2
+I64_API void i64_andArrayAVX2(i64 *I64_RESTRICT out, const i64 *I64_RESTRICT a,
+		const i64 *I64_RESTRICT b, size_t n) {
+	size_t i;
+	for(i = 0; i + 4 <= n; i += 4) {
+		I64_STORE256_(out + i,
+			_mm256_and_si256(I64_LOAD256_(a + i), I64_LOAD256_(b + i)));
+	}
+	i64_andArray(out + i, a + i, b + i, n - i);
+}
+
+I64_TARGET_AVX2
+I64_API void i64_orArrayAVX2(i64 *I64_RESTRICT out, const i64 *I64_RESTRICT a,
+		const i64 *I64_RESTRICT b, size_t n) {
+	size_t i;
+	for(i = 0; i + 4 <= n; i += 4) {
+		I64_STORE256_(out + i,
+			_mm256_or_si256(I64_LOAD256_(a + i), I64_LOAD256_(b + i)));
+	}
+	i64_orArray(out + i, a + i, b + i, n - i);
+}
+
+I64_TARGET_AVX2
+I64_API void i64_xorArrayAVX2(i64 *I64_RESTRICT out, const i64 *I64_RESTRICT a,
+		const i64 *I64_RESTRICT b, size_t n) {
+	size_t i;
+	for(i = 0; i + 4 <= n; i += 4) {
+		I64_STORE256_(out + i,
+			_mm256_xor_si256(I64_LOAD256_(a + i), I64_LOAD256_(b + i)));
+	}
+	i64_xorArray(out + i, a + i, b + i, n - i);
+}
+
+I64_TARGET_AVX2
+I64_API void i64_notArrayAVX2(i64 *I64_RESTRICT out, const i64 *I64_RESTRICT a,
+		size_t n) {
+	size_t i;
+	__m256i ones = _mm256_set1_epi32(-1);
+	for(i = 0; i + 4 <= n; i += 4) {
+		I64_STORE256_(out + i, _mm256_xor_si256(I64_LOAD256_(a + i), ones));
+	}
+	i64_notArray(out + i, a + i, n - i);
+}
+
+/*
+	MULTIPLICATION KERNELS
+	======================
+	As in the C89 i64_multiply, the product modulo 2^64 is
+		low * low + 2^32 * (high * low + low * high),
+	and pmuludq (_mm_mul_epu32) multiplies the low 32 bits of
+	each 64-bit lane into a full 64-bit product -- exactly
+	the low * low term. Shifting an operand right by 32
+	first gives the two cross products, of which we keep only
+	the low 32 bits by shifting their sum back left.
+*/
+
+I64_TARGET_SSE2
+I64_API void i64_multiplyArraySSE2(i64 *I64_RESTRICT out,
+		const i64 *I64_RESTRICT a, const i64 *I64_RESTRICT b, size_t n) {
+	size_t i;
+	__m128i va, vb, cross;
+	for(i = 0; i + 2 <= n; i += 2) {
+		va = I64_LOAD128_(a + i);
+		vb = I64_LOAD128_(b + i);
+		cross = _mm_add_epi64(
+			_mm_mul_epu32(_mm_srli_epi64(va, 32), vb),
+			_mm_mul_epu32(va, _mm_srli_epi64(vb, 32)));
+		I64_STORE128_(out + i, _mm_add_epi64(
+			_mm_mul_epu32(va, vb), _mm_slli_epi64(cross, 32)));
+	}
+	i64_multiplyArray(out + i, a + i, b + i, n - i);
+}
+
+I64_TARGET_AVX2
+I64_API void i64_multiplyArrayAVX2(i64 *I64_RESTRICT out,
+		const i64 *I64_RESTRICT a, const i64 *I64_RESTRICT b, size_t n) {
+	size_t i;
+	__m256i va, vb, cross;
+	for(i = 0; i + 4 <= n; i += 4) {
+		va = I64_LOAD256_(a + i);
+		vb = I64_LOAD256_(b + i);
+		cross = _mm256_add_epi64(
+			_mm256_mul_epu32(_mm256_srli_epi64(va, 32), vb),
+			_mm256_mul_epu32(va, _mm256_srli_epi64(vb, 32)));
+		I64_STORE256_(out + i, _mm256_add_epi64(
+			_mm256_mul_epu32(va, vb), _mm256_slli_epi64(cross, 32)));
+	}
+	i64_multiplyArray(out + i, a + i, b + i, n - i);
+}
+
+/*
+	STRUCTURE-OF-ARRAYS KERNELS
+	===========================
+	An i64_soa keeps the words apart, so here we add in
+	32-bit lanes and carry by hand: the low words wrapped
+	around (carried) exactly where the sum is less than an
+	addend, as unsigned. x86 only compares signed lanes, so
+	we flip the sign bits of both sides first, which turns
+	an unsigned comparison into a signed one. The comparison
+	gives -1 where it holds, so we subtract it to add the carry.
+*/
+
+/*
+	The 'length' elements of 'column' from index 'from' on,
+	for finishing a kernel with the scalar loop.
+*/
+I64_API i64_soa i64_soaSlice_(const i64_soa *column, size_t from,
+		size_t length) {
+	i64_soa ret;
+	ret.low = column->low + from;
+	ret.high = column->high + from;
+	ret.length = length;
+	return ret;
+}
+
+#define I64_SOA_FINISH_(scalarOp, out, a, b, i) { \
+		i64_soa restOut_ = i64_soaSlice_(out, i, (a)->length - (i)); \
+		i64_soa restA_ = i64_soaSlice_(a, i, (a)->length - (i)); \
+		i64_soa restB_ = i64_soaSlice_(b, i, (a)->length - (i)); \
+		scalarOp(&restOut_, &restA_, &restB_); \
+	}
+
+I64_TARGET_SSE2
+I64_API void i64_soaAddSSE2(const i64_soa *out, const i64_soa *a,
+		const i64_soa *b) {
+	size_t i;
+	__m128i bias = _mm_set1_epi32((i32)0x80000000);
+	__m128i al, low, carry;
+	for(i = 0; i + 4 <= a->length; i += 4) {
+		al = I64_LOAD128_(a->low + i);
+		low = _mm_add_epi32(al, I64_LOAD128_(b->low + i));
+		carry = _mm_cmpgt_epi32(
+			_mm_xor_si128(al, bias), _mm_xor_si128(low, bias));
+		I64_STORE128_(out->low + i, low);
+		I64_STORE128_(out->high + i, _mm_sub_epi32(
+			_mm_add_epi32(I64_LOAD128_(a->high + i),
+				I64_LOAD128_(b->high + i)),
+			carry));
+	}
+	I64_SOA_FINISH_(i64_soaAdd, out, a, b, i);
+}
+
+/* Borrows are where the low word of 'a' is the lesser. */
+I64_TARGET_SSE2
+I64_API void i64_soaSubtractSSE2(const i64_soa *out, const i64_soa *a,
+		const i64_soa *b) {
+	size_t i;
+	__m128i bias = _mm_set1_epi32((i32)0x80000000);
+	__m128i al, bl, borrow;
+	for(i = 0; i + 4 <= a->length; i += 4) {
+		al = I64_LOAD128_(a->low + i);
+		bl = I64_LOAD128_(b->low + i);
+		borrow = _mm_cmpgt_epi32(
+			_mm_xor_si128(bl, bias), _mm_xor_si128(al, bias));
+		I64_STORE128_(out->low + i, _mm_sub_epi32(al, bl));
+		I64_STORE128_(out->high + i, _mm_add_epi32(
+			_mm_sub_epi32(I64_LOAD128_(a->high + i),
+				I64_LOAD128_(b->high + i)),
+			borrow));
+	}
+	I64_SOA_FINISH_(i64_soaSubtract, out, a, b, i);
+}
+
+I64_TARGET_AVX2
+I64_API void i64_soaAddAVX2(const i64_soa *out, const i64_soa *a,
+		const i64_soa *b) {
+	size_t i;
+	__m256i bias = _mm256_set1_epi32((i32)0x80000000);
+	__m256i al, low, carry;
+	for(i = 0; i + 8 <= a->length; i += 8) {
+		al = I64_LOAD256_(a->low + i);
+		low = _mm256_add_epi32(al, I64_LOAD256_(b->low + i));
+		carry = _mm256_cmpgt_epi32(
+			_mm256_xor_si256(al, bias), _mm256_xor_si256(low, bias));
+		I64_STORE256_(out->low + i, low);
+		I64_STORE256_(out->high + i, _mm256_sub_epi32(
+			_mm256_add_epi32(I64_LOAD256_(a->high + i),
+				I64_LOAD256_(b->high + i)),
+			carry));
+	}
+	I64_SOA_FINISH_(i64_soaAdd, out, a, b, i);
+}
+
+I64_TARGET_AVX2
+I64_API void i64_soaSubtractAVX2(const i64_soa *out, const i64_soa *a,
+		const i64_soa *b) {
+	size_t i;
+	__m256i bias = _mm256_set1_epi32((i32)0x80000000);
+	__m256i al, bl, borrow;
+	for(i = 0; i + 8 <= a->length; i += 8) {
+		al = I64_LOAD256_(a->low + i);
+		bl = I64_LOAD256_(b->low + i);
+		borrow = _mm256_cmpgt_epi32(
+			_mm256_xor_si256(bl, bias), _mm256_xor_si256(al, bias));
+		I64_STORE256_(out->low + i, _mm256_sub_epi32(al, bl));
+		I64_STORE256_(out->high + i, _mm256_add_epi32(
+			_mm256_sub_epi32(I64_LOAD256_(a->high + i),
+				I64_LOAD256_(b->high + i)),
+			borrow));
+	}
+	I64_SOA_FINISH_(i64_soaSubtract, out, a, b, i);
+}
+
+/*
+	COMPARISON KERNELS
+	==================
+	SSE2 has no 64-bit comparison, so we build a signed
+	'greater than' out of 32-bit ones: where the high words
+	differ their signed comparison decides, and where they
+	are equal the borrow out of the low words of b - a
+	(left in the high word of the difference, as -1 or 0)
+	does. Either way the answer is in the high word of each
+	lane, which we then copy over the low word. AVX2 has a
+	64-bit comparison (pcmpgtq) of its own.
+	
+	movmskpd gathers the sign bit of each 64-bit lane, i.e.
+	one predicate bit per element, and the predicate is then
+	put together as in i64_compareArrayToMask.
+*/
+
+/* Decodes 'predicate' into masks over 'laneMask' bits. */
+#define I64_CMP_DECODE_(predicate, laneMask, ltMask, eqMask, invert) \
+	ltMask = -((predicate & I64_CMP_LT_BIT_) != 0); \
+	eqMask = -((predicate & I64_CMP_EQ_BIT_) != 0); \
+	invert = -((predicate & I64_CMP_INVERT_BIT_) != 0) & (laneMask)
+
+I64_TARGET_SSE2
+I64_API __m128i i64_greaterThanSSE2_(__m128i a, __m128i b) {
+	__m128i r = _mm_and_si128(_mm_cmpeq_epi32(a, b), _mm_sub_epi64(b, a));
+	r = _mm_or_si128(r, _mm_cmpgt_epi32(a, b));
+	return _mm_shuffle_epi32(r, _MM_SHUFFLE(3, 3, 1, 1));
+}
+
+/* Lanes are equal where both of their words are. */
+I64_TARGET_SSE2
+I64_API __m128i i64_equalsSSE2_(__m128i a, __m128i b) {
+	__m128i eq32 = _mm_cmpeq_epi32(a, b);
+	return _mm_and_si128(eq32,
+		_mm_shuffle_epi32(eq32, _MM_SHUFFLE(2, 3, 0, 1)));
+}
+
+#define I64_LANE_BITS128_(v) _mm_movemask_pd(_mm_castsi128_pd(v))
+#define I64_LANE_BITS256_(v) _mm256_movemask_pd(_mm256_castsi256_pd(v))
+
+/* The predicate bits of both lanes of a and b. */
+I64_TARGET_SSE2
+I64_API int i64_predicateBitsSSE2_(__m128i a, __m128i b,
+		int ltMask, int eqMask, int invert) {
+	return ((I64_LANE_BITS128_(i64_greaterThanSSE2_(b, a)) & ltMask)
+		| (I64_LANE_BITS128_(i64_equalsSSE2_(a, b)) & eqMask)) ^ invert;
+}
+
+I64_TARGET_SSE2
+I64_API void i64_compareArrayToMaskSSE2(const i64 *I64_RESTRICT a,
+		const i64 *I64_RESTRICT b, size_t n, int predicate,
+		unsigned char *I64_RESTRICT mask) {
+	int ltMask, eqMask, invert, byte;
+	size_t i, j;
+	I64_CMP_DECODE_(predicate, 3, ltMask, eqMask, invert);
+	for(i = 0; i + 8 <= n; i += 8) {
+		byte = 0;
+		for(j = 0; j < 8; j += 2) {
+			byte |= i64_predicateBitsSSE2_(
+				I64_LOAD128_(a + i + j), I64_LOAD128_(b + i + j),
+				ltMask, eqMask, invert) << j;
+		}
+		mask[i / 8] = (unsigned char)byte;
+	}
+	i64_compareArrayToMask(a + i, b + i, n - i, predicate, mask + i / 8);
+}
+
+I64_TARGET_SSE2
+I64_API void i64_compareScalarArrayToMaskSSE2(const i64 *I64_RESTRICT a, i64 b,
+		size_t n, int predicate, unsigned char *I64_RESTRICT mask) {
+	int ltMask, eqMask, invert, byte;
+	size_t i, j;
+	__m128i vb = _mm_set_epi32(b.high_, b.low_, b.high_, b.low_);
+	I64_CMP_DECODE_(predicate, 3, ltMask, eqMask, invert);
+	for(i = 0; i + 8 <= n; i += 8) {
+		byte = 0;
+		for(j = 0; j < 8; j += 2) {
+			byte |= i64_predicateBitsSSE2_(I64_LOAD128_(a + i + j), vb,
+				ltMask, eqMask, invert) << j;
+		}
+		mask[i / 8] = (unsigned char)byte;
+	}
+	i64_compareScalarArrayToMask(a + i, b, n - i, predicate, mask + i / 8);
+}
+
+/* The predicate bits of all four lanes of a and b. */
+I64_TARGET_AVX2
+I64_API int i64_predicateBitsAVX2_(__m256i a, __m256i b,
+		int ltMask, int eqMask, int invert) {
+	return ((I64_LANE_BITS256_(_mm256_cmpgt_epi64(b, a)) & ltMask)
+		| (I64_LANE_BITS256_(_mm256_cmpeq_epi64(a, b)) & eqMask)) ^ invert;
+}
+
+I64_TARGET_AVX2
+I64_API void i64_compareArrayToMaskAVX2(const i64 *I64_RESTRICT a,
+		const i64 *I64_RESTRICT b, size_t n, int predicate,
+		unsigned char *I64_RESTRICT mask) {
+	int ltMask, eqMask, invert;
+	size_t i;
+	I64_CMP_DECODE_(predicate, 15, ltMask, eqMask, invert);
+	for(i = 0; i + 8 <= n; i += 8) {
+		mask[i / 8] = (unsigned char)(
+			i64_predicateBitsAVX2_(I64_LOAD256_(a + i), I64_LOAD256_(b + i),
+				ltMask, eqMask, invert)
+			| (i64_predicateBitsAVX2_(
+				I64_LOAD256_(a + i + 4), I64_LOAD256_(b + i + 4),
+				ltMask, eqMask, invert) << 4));
+	}
+	i64_compareArrayToMask(a + i, b + i, n - i, predicate, mask + i / 8);
+}
+
+I64_TARGET_AVX2
+I64_API void i64_compareScalarArrayToMaskAVX2(const i64 *I64_RESTRICT a, i64 b,
+		size_t n, int predicate, unsigned char *I64_RESTRICT mask) {
+	int ltMask, eqMask, invert;
+	size_t i;
+	__m256i vb = _mm256_set_epi32(b.high_, b.low_, b.high_, b.low_,
+		b.high_, b.low_, b.high_, b.low_);
+	I64_CMP_DECODE_(predicate, 15, ltMask, eqMask, invert);
+	for(i = 0; i + 8 <= n; i += 8) {
+		mask[i / 8] = (unsigned char)(
+			i64_predicateBitsAVX2_(I64_LOAD256_(a + i), vb,
+				ltMask, eqMask, invert)
+			| (i64_predicateBitsAVX2_(I64_LOAD256_(a + i + 4), vb,
+				ltMask, eqMask, invert) << 4));
+	}
+	i64_compareScalarArrayToMask(a + i, b, n - i, predicate, mask + i / 8);
+}
+
+/*
+	FILTER KERNELS
+	==============
+	The comparisons are done as above, a vector at a time;
+	the bits of the lanes that matched are then appended to
+	the selection vector with the same write-then-advance
+	loop as the scalar filters.
+*/
+
+#define I64_SELECT_LANES_(sel, count, base, bits, lanes) { \
+		int lane_; \
+		for(lane_ = 0; lane_ < (lanes); lane_++) { \
+			(sel)[count] = (u32)((base) + lane_); \
+			count += ((bits) >> lane_) & 1; \
+		} \
+	}
+
+/*
+	Adds 'from' to the 'count' indices that a scalar filter
+	selected from the tail of an array starting at 'from'.
+*/
+I64_API size_t i64_offsetSelection_(u32 *sel, size_t count, size_t from) {
+	size_t i;
+	for(i = 0; i < count; i++) {
+		sel[i] += (u32)from;
+	}
+	return count;
+}
+
+I64_TARGET_SSE2
+I64_API size_t i64_filterRangeSSE2(const i64 *I64_RESTRICT a, size_t n, i64 lo,
+		i64 hi, u32 *I64_RESTRICT sel) {
+	size_t i, count = 0;
+	int bits;
+	__m128i va;
+	__m128i vlo = _mm_set_epi32(lo.high_, lo.low_, lo.high_, lo.low_);
+	__m128i vhi = _mm_set_epi32(hi.high_, hi.low_, hi.high_, hi.low_);
+	for(i = 0; i + 2 <= n; i += 2) {
+		va = I64_LOAD128_(a + i);
+		bits = ~I64_LANE_BITS128_(i64_greaterThanSSE2_(vlo, va))
+			& I64_LANE_BITS128_(i64_greaterThanSSE2_(vhi, va));
+		I64_SELECT_LANES_(sel, count, i, bits, 2);
+	}
+	return count + i64_offsetSelection_(sel + count,
+		i64_filterRange(a + i, n - i, lo, hi, sel + count), i);
+}
+
+I64_TARGET_SSE2
+I64_API size_t i64_filterEqualsSSE2(const i64 *I64_RESTRICT a, size_t n,
+		i64 value, u32 *I64_RESTRICT sel) {
+	size_t i, count = 0;
+	int bits;
+	__m128i vv = _mm_set_epi32(value.high_, value.low_,
+		value.high_, value.low_);
+	for(i = 0; i + 2 <= n; i += 2) {
+		bits = I64_LANE_BITS128_(i64_equalsSSE2_(I64_LOAD128_(a + i), vv));
+		I64_SELECT_LANES_(sel, count, i, bits, 2);
+	}
+	return count + i64_offsetSelection_(sel + count,
+		i64_filterEquals(a + i, n - i, value, sel + count), i);
+}
+
+I64_TARGET_SSE2
+I64_API size_t i64_filterNotEqualsSSE2(const i64 *I64_RESTRICT a, size_t n,
+		i64 value, u32 *I64_RESTRICT sel) {
+	size_t i, count = 0;
+	int bits;
+	__m128i vv = _mm_set_epi32(value.high_, value.low_,
+		value.high_, value.low_);
+	for(i = 0; i + 2 <= n; i += 2) {
+		bits = ~I64_LANE_BITS128_(i64_equalsSSE2_(I64_LOAD128_(a + i), vv));
+		I64_SELECT_LANES_(sel, count, i, bits, 2);
+	}
+	return count + i64_offsetSelection_(sel + count,
+		i64_filterNotEquals(a + i, n - i, value, sel + count), i);
+}
+
+I64_TARGET_AVX2
+I64_API size_t i64_filterRangeAVX2(const i64 *I64_RESTRICT a, size_t n, i64 lo,
+		i64 hi, u32 *I64_RESTRICT sel) {
+	size_t i, count = 0;
+	int bits;
+	__m256i va;
+	__m256i vlo = _mm256_set_epi32(lo.high_, lo.low_, lo.high_, lo.low_,
+		lo.high_, lo.low_, lo.high_, lo.low_);
+	__m256i vhi = _mm256_set_epi32(hi.high_, hi.low_, hi.high_, hi.low_,
+		hi.high_, hi.low_, hi.high_, hi.low_);
+	for(i = 0; i + 4 <= n; i += 4) {
+		va = I64_LOAD256_(a + i);
+		bits = ~I64_LANE_BITS256_(_mm256_cmpgt_epi64(vlo, va))
+			& I64_LANE_BITS256_(_mm256_cmpgt_epi64(vhi, va));
+		I64_SELECT_LANES_(sel, count, i, bits, 4);
+	}
+	return count + i64_offsetSelection_(sel + count,
+		i64_filterRange(a + i, n - i, lo, hi, sel + count), i);
+}
+
+I64_TARGET_AVX2
+I64_API size_t i64_filterEqualsAVX2(const i64 *I64_RESTRICT a, size_t n,
+		i64 value, u32 *I64_RESTRICT sel) {
+	size_t i, count = 0;
+	int bits;
+	__m256i vv = _mm256_set_epi32(value.high_, value.low_,
+		value.high_, value.low_, value.high_, value.low_,
+		value.high_, value.low_);
+	for(i = 0; i + 4 <= n; i += 4) {
+		bits = I64_LANE_BITS256_(_mm256_cmpeq_epi64(I64_LOAD256_(a + i), vv));
+		I64_SELECT_LANES_(sel, count, i, bits, 4);
+	}
+	return count + i64_offsetSelection_(sel + count,
+		i64_filterEquals(a + i, n - i, value, sel + count), i);
+}
+
+I64_TARGET_AVX2
+I64_API size_t i64_filterNotEqualsAVX2(const i64 *I64_RESTRICT a, size_t n,
+		i64 value, u32 *I64_RESTRICT sel) {
+	size_t i, count = 0;
+	int bits;
+	__m256i vv = _mm256_set_epi32(value.high_, value.low_,
+		value.high_, value.low_, value.high_, value.low_,
+		value.high_, value.low_);
+	for(i = 0; i + 4 <= n; i += 4) {
+		bits = ~I64_LANE_BITS256_(_mm256_cmpeq_epi64(I64_LOAD256_(a + i), vv));
+		I64_SELECT_LANES_(sel, count, i, bits, 4);
+	}
+	return count + i64_offsetSelection_(sel + count,
+		i64_filterNotEquals(a + i, n - i, value, sel + count), i);
+}
+
+/*
+	CONVERSION KERNELS
+	==================
+	Neither SSE2 nor AVX2 converts 64-bit integers to
+	doubles, so we convert the two words separately, each
+	exactly, by placing it in the mantissa of a double of
+	known exponent and subtracting that double's bias:
+	
+		the low word as 2^52 + low, less 2^52;
+		the high word (with its sign bit flipped, to make it
+		unsigned) as 2^84 + 2^32 * (high + 2^31), less
+		2^84 + 2^63.
+	
+	Adding the two then rounds once, as in i64_toDouble.
+*/
+
+#define I64_TWO_PWR_52_BITS_ 0x43300000
+#define I64_TWO_PWR_84_BITS_ 0x45300000
+#define I64_TWO_PWR_84_63_DBL_ 19342822337206103650074624.0
+	/* 2^84 + 2^63 */
+
+I64_TARGET_SSE2
+I64_API void i64_toDoubleArraySSE2(double *I64_RESTRICT out,
+		const i64 *I64_RESTRICT a, size_t n) {
+	size_t i;
+	__m128i lowMask = _mm_set_epi32(0, -1, 0, -1);
+	__m128i lowBias = _mm_set_epi32(I64_TWO_PWR_52_BITS_, 0,
+		I64_TWO_PWR_52_BITS_, 0);
+	__m128i highBias = _mm_set_epi32(I64_TWO_PWR_84_BITS_, (i32)0x80000000,
+		I64_TWO_PWR_84_BITS_, (i32)0x80000000);
+	__m128d lowOffset = _mm_set1_pd(4503599627370496.0); /* 2^52 */
+	__m128d highOffset = _mm_set1_pd(I64_TWO_PWR_84_63_DBL_);
+	__m128i va;
+	__m128d low, high;
+	for(i = 0; i + 2 <= n; i += 2) {
+		va = I64_LOAD128_(a + i);
+		low = _mm_sub_pd(_mm_castsi128_pd(
+			_mm_or_si128(_mm_and_si128(va, lowMask), lowBias)), lowOffset);
+		high = _mm_sub_pd(_mm_castsi128_pd(
+			_mm_xor_si128(_mm_srli_epi64(va, 32), highBias)), highOffset);
+		_mm_storeu_pd(out + i, _mm_add_pd(high, low));
+	}
+	i64_toDoubleArray(out + i, a + i, n - i);
+}
+
+I64_TARGET_AVX2
+I64_API void i64_toDoubleArrayAVX2(double *I64_RESTRICT out,
+		const i64 *I64_RESTRICT a, size_t n) {
+	size_t i;
+	__m256i lowMask = _mm256_set_epi32(0, -1, 0, -1, 0, -1, 0, -1);
+	__m256i lowBias = _mm256_set_epi32(I64_TWO_PWR_52_BITS_, 0,
+		I64_TWO_PWR_52_BITS_, 0, I64_TWO_PWR_52_BITS_, 0,
+		I64_TWO_PWR_52_BITS_, 0);
+	__m256i highBias = _mm256_set_epi32(
+		I64_TWO_PWR_84_BITS_, (i32)0x80000000,
+		I64_TWO_PWR_84_BITS_, (i32)0x80000000,
+		I64_TWO_PWR_84_BITS_, (i32)0x80000000,
+		I64_TWO_PWR_84_BITS_, (i32)0x80000000);
+	__m256d lowOffset = _mm256_set1_pd(4503599627370496.0); /* 2^52 */
+	__m256d highOffset = _mm256_set1_pd(I64_TWO_PWR_84_63_DBL_);
+	__m256i va;
+	__m256d low, high;
+	for(i = 0; i + 4 <= n; i += 4) {
+		va = I64_LOAD256_(a + i);
+		low = _mm256_sub_pd(_mm256_castsi256_pd(
+			_mm256_or_si256(_mm256_and_si256(va, lowMask), lowBias)),
+			lowOffset);
+		high = _mm256_sub_pd(_mm256_castsi256_pd(
+			_mm256_xor_si256(_mm256_srli_epi64(va, 32), highBias)),
+			highOffset);
+		_mm256_storeu_pd(out + i, _mm256_add_pd(high, low));
+	}
+	i64_toDoubleArray(out + i, a + i, n - i);
+}
+
+/*
+	Probe the CPU for the best kernels it can run: AVX2 needs
+	both the instructions (cpuid leaf 7) and the OS saving the
+	256-bit registers (OSXSAVE, then XCR0 bits 1 and 2).
+	
+	We have no AVX-512 kernels; AVX-512 CPUs run the AVX2 ones.
+*/
+I64_API int i64_probeSimdLevel_(void) {
+	unsigned int eax, ebx, ecx, edx, xcr0Low;
+#if defined(_MSC_VER)
+	int info[4];
+	__cpuid(info, 0);
+	eax = info[0];
+	if(eax < 1) {
+		return I64_SIMD_NONE;
+	}
+	__cpuid(info, 1);
+	ecx = info[2];
+	edx = info[3];
+#else
+	if(!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+		return I64_SIMD_NONE;
+	}
+#endif
+	if((edx & (1u << 26)) == 0) {
+		return I64_SIMD_NONE;
+	}
+	if((ecx & (1u << 27)) == 0) {
+		/* no OSXSAVE: the OS does not save AVX state. */
+		return I64_SIMD_SSE2;
+	}
+#if defined(_MSC_VER)
+	if(eax < 7) {
+		return I64_SIMD_SSE2;
+	}
+	xcr0Low = (unsigned int)_xgetbv(0);
+	__cpuidex(info, 7, 0);
+	ebx = info[1];
+#else
+	__asm__ ("xgetbv" : "=a"(xcr0Low), "=d"(edx) : "c"(0));
+	if(!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
+		return I64_SIMD_SSE2;
+	}
+#endif
+	if((xcr0Low & 6) != 6 || (ebx & (1u << 5)) == 0) {
+		return I64_SIMD_SSE2;
+	}
+	return I64_SIMD_AVX2;
+}
+#endif /* I64_DEFINE_ */
+
+#endif /* I64_SIMD_X86 */
+
+/*
+	DISPATCH
+	========
+	i64_kernels holds the array operations for the selected
+	kernel level. It starts out with the portable loops;
+	i64_initKernels probes the CPU once and switches to the
+	best kernels it supports, and i64_setSimdLevel forces a
+	level (e.g. so that benchmarks and tests can run each
+	path on one machine). Neither is thread-safe: call them
+	before sharing i64_kernels between threads.
+	
+	On hosts other than x86, every level runs the portable
+	loops.
+*/
+
+typedef struct {
+	void (*addArray)(i64 *I64_RESTRICT out, const i64 *I64_RESTRICT a,
+		const i64 *I64_RESTRICT b, size_t n);
+	void (*subtractArray)(i64 *I64_RESTRICT out, const i64 *I64_RESTRICT a,
+		const i64 *I64_RESTRICT b, size_t n);
+	void (*multiplyArray)(i64 *I64_RESTRICT out, const i64 *I64_RESTRICT a,
+		const i64 *I64_RESTRICT b, size_t n);
+	void (*negateArray)(i64 *I64_RESTRICT out, const i64 *I64_RESTRICT a,
+		size_t n);
+	void (*andArray)(i64 *I64_RESTRICT out, const i64 *I64_RESTRICT a,
+		const i64 *I64_RESTRICT b, size_t n);
+	void (*orArray)(i64 *I64_RESTRICT out, const i64 *I64_RESTRICT a,
+		const i64 *I64_RESTRICT b, size_t n);
+	void (*xorArray)(i64 *I64_RESTRICT out, const i64 *I64_RESTRICT a,
+		const i64 *I64_RESTRICT b, size_t n);
+	void (*notArray)(i64 *I64_RESTRICT out, const i64 *I64_RESTRICT a,
+		size_t n);
+	void (*soaAdd)(const i64_soa *out, const i64_soa *a, const i64_soa *b);
+	void (*soaSubtract)(const i64_soa *out, const i64_soa *a,
+		const i64_soa *b);
+	void (*compareArrayToMask)(const i64 *I64_RESTRICT a,
+		const i64 *I64_RESTRICT b, size_t n, int predicate,
+		unsigned char *I64_RESTRICT mask);
+	void (*compareScalarArrayToMask)(const i64 *I64_RESTRICT a, i64 b,
+		size_t n, int predicate, unsigned char *I64_RESTRICT mask);
+	size_t (*filterRange)(const i64 *I64_RESTRICT a, size_t n, i64 lo, i64 hi,
+		u32 *I64_RESTRICT sel);
+	size_t (*filterEquals)(const i64 *I64_RESTRICT a, size_t n, i64 value,
+		u32 *I64_RESTRICT sel);
+	size_t (*filterNotEquals)(const i64 *I64_RESTRICT a, size_t n, i64 value,
+		u32 *I64_RESTRICT sel);
+	void (*toDoubleArray)(double *I64_RESTRICT out, const i64 *I64_RESTRICT a,
+		size_t n);
+} i64_kernelTable;
+
+#ifdef I64_DEFINE_
+I64_GLOBAL_ i64_kernelTable i64_kernels = {
+	i64_addArray,
+	i64_subtractArray,
+	i64_multiplyArray,
+	i64_negateArray,
+	i64_andArray,
+	i64_orArray,
+	i64_xorArray,
+	i64_notArray,
+	i64_soaAdd,
+	i64_soaSubtract,
+	i64_compareArrayToMask,
+	i64_compareScalarArrayToMask,
+	i64_filterRange,
+	i64_filterEquals,
+	i64_filterNotEquals,
+	i64_toDoubleArray
+};
+
+I64_GLOBAL_ int i64_simdLevel_ = I64_SIMD_NONE;
+I64_GLOBAL_ int i64_detectedSimdLevel_ = -1;
+	/* -1 until the CPU has been probed */
+
+/* The best kernel level this CPU supports (probed once). */
+I64_API int i64_detectSimdLevel(void) {
+	if(i64_detectedSimdLevel_ < 0) {
+#ifdef I64_SIMD_X86
+		i64_detectedSimdLevel_ = i64_probeSimdLevel_();
+#else
+		i64_detectedSimdLevel_ = I64_SIMD_NONE;
+#endif
+	}
+	return i64_detectedSimdLevel_;
+}
+
+/* The kernel level i64_kernels currently holds. */
+I64_API int i64_getSimdLevel(void) {
+	return i64_simdLevel_;
+}
+
+/*
+	Fills i64_kernels for 'level', lowered to what the CPU
+	supports if need be, and returns the level selected.
+*/
+I64_API int i64_setSimdLevel(int level) {
+	if(level > i64_detectSimdLevel()) {
+		level = i64_detectSimdLevel();
+	}
+	if(level < I64_SIMD_NONE) {
+		level = I64_SIMD_NONE;
+	}
+
+	i64_kernels.addArray = i64_addArray;
+	i64_kernels.subtractArray = i64_subtractArray;
+	i64_kernels.multiplyArray = i64_multiplyArray;
+	i64_kernels.negateArray = i64_negateArray;
+	i64_kernels.andArray = i64_andArray;
+	i64_kernels.orArray = i64_orArray;
+	i64_kernels.xorArray = i64_xorArray;
+	i64_kernels.notArray = i64_notArray;
+	i64_kernels.soaAdd = i64_soaAdd;
+	i64_kernels.soaSubtract = i64_soaSubtract;
+	i64_kernels.compareArrayToMask = i64_compareArrayToMask;
+	i64_kernels.compareScalarArrayToMask =
+		i64_compareScalarArrayToMask;
+	i64_kernels.filterRange = i64_filterRange;
+	i64_kernels.filterEquals = i64_filterEquals;
+	i64_kernels.filterNotEquals = i64_filterNotEquals;
+	i64_kernels.toDoubleArray = i64_toDoubleArray;
+#ifdef I64_SIMD_X86
+	if(level == I64_SIMD_SSE2) {
+		i64_kernels.addArray = i64_addArraySSE2;
+		i64_kernels.subtractArray = i64_subtractArraySSE2;
+		i64_kernels.multiplyArray = i64_multiplyArraySSE2;
+		i64_kernels.negateArray = i64_negateArraySSE2;
+		i64_kernels.andArray = i64_andArraySSE2;
+		i64_kernels.orArray = i64_orArraySSE2;
+		i64_kernels.xorArray = i64_xorArraySSE2;
+		i64_kernels.notArray = i64_notArraySSE2;
+		i64_kernels.soaAdd = i64_soaAddSSE2;
+		i64_kernels.soaSubtract = i64_soaSubtractSSE2;
+		i64_kernels.compareArrayToMask = i64_compareArrayToMaskSSE2;
+		i64_kernels.compareScalarArrayToMask =
+			i64_compareScalarArrayToMaskSSE2;
+		i64_kernels.filterRange = i64_filterRangeSSE2;
+		i64_kernels.filterEquals = i64_filterEqualsSSE2;
+		i64_kernels.filterNotEquals = i64_filterNotEqualsSSE2;
+		i64_kernels.toDoubleArray = i64_toDoubleArraySSE2;
+	} else if(level == I64_SIMD_AVX2) {
+		i64_kernels.addArray = i64_addArrayAVX2;
+		i64_kernels.subtractArray = i64_subtractArrayAVX2;
+		i64_kernels.multiplyArray = i64_multiplyArrayAVX2;
+		i64_kernels.negateArray = i64_negateArrayAVX2;
+		i64_kernels.andArray = i64_andArrayAVX2;
+		i64_kernels.orArray = i64_orArrayAVX2;
+		i64_kernels.xorArray = i64_xorArrayAVX2;
+		i64_kernels.notArray = i64_notArrayAVX2;
+		i64_kernels.soaAdd = i64_soaAddAVX2;
+		i64_kernels.soaSubtract = i64_soaSubtractAVX2;
+		i64_kernels.compareArrayToMask = i64_compareArrayToMaskAVX2;
+		i64_kernels.compareScalarArrayToMask =
+			i64_compareScalarArrayToMaskAVX2;
+		i64_kernels.filterRange = i64_filterRangeAVX2;
+		i64_kernels.filterEquals = i64_filterEqualsAVX2;
+		i64_kernels.filterNotEquals = i64_filterNotEqualsAVX2;
+		i64_kernels.toDoubleArray = i64_toDoubleArrayAVX2;
+	}
+#endif
+	i64_simdLevel_ = level;
+	return level;
+}
+
+/* Selects the best kernels for this CPU. */
+I64_API int i64_initKernels(void) {
+	return i64_setSimdLevel(i64_detectSimdLevel());
+}
+
+#endif /* I64_DEFINE_ */
+
+#ifndef I64_DEFINE_
+/* See DECLARATIONS in i64_c89.h. */
+#ifdef I64_SIMD_X86
+/* Array kernels */
+I64_API void i64_addArraySSE2(i64 *I64_RESTRICT out, const i64 *I64_RESTRICT a,
+		const i64 *I64_RESTRICT b, size_t n);
+I64_API void i64_subtractArraySSE2(i64 *I64_RESTRICT out,
+		const i64 *I64_RESTRICT a, const i64 *I64_RESTRICT b, size_t n);
+I64_API void i64_negateArraySSE2(i64 *I64_RESTRICT out,
+		const i64 *I64_RESTRICT a, size_t n);
+I64_API void i64_andArraySSE2(i64 *I64_RESTRICT out, const i64 *I64_RESTRICT a,
+		const i64 *I64_RESTRICT b, size_t n);
+I64_API void i64_orArraySSE2(i64 *I64_RESTRICT out, const i64 *I64_RESTRICT a,
+		const i64 *I64_RESTRICT b, size_t n);
+I64_API void i64_xorArraySSE2(i64 *I64_RESTRICT out, const i64 *I64_RESTRICT a,
+		const i64 *I64_RESTRICT b, size_t n);
+I64_API void i64_notArraySSE2(i64 *I64_RESTRICT out, const i64 *I64_RESTRICT a,
+		size_t n);
+I64_API void i64_addArrayAVX2(i64 *I64_RESTRICT out, const i64 *I64_RESTRICT a,
+		const i64 *I64_RESTRICT b, size_t n);
+I64_API void i64_subtractArrayAVX2(i64 *I64_RESTRICT out,
+		const i64 *I64_RESTRICT a, const i64 *I64_RESTRICT b, size_t n);
+I64_API void i64_negateArrayAVX2(i64 *I64_RESTRICT out,
+		const i64 *I64_RESTRICT a, size_t n);
+I64_API void i64_andArrayAVX2(i64 *I64_RESTRICT out, const i64 *I64_RESTRICT a,
+		const i64 *I64_RESTRICT b, size_t n);
+I64_API void i64_orArrayAVX2(i64 *I64_RESTRICT out, const i64 *I64_RESTRICT a,
+		const i64 *I64_RESTRICT b, size_t n);
+I64_API void i64_xorArrayAVX2(i64 *I64_RESTRICT out, const i64 *I64_RESTRICT a,
+		const i64 *I64_RESTRICT b, size_t n);
+I64_API void i64_notArrayAVX2(i64 *I64_RESTRICT out, const i64 *I64_RESTRICT a,
+		size_t n);
+
+/* Multiplication kernels */
+I64_API void i64_multiplyArraySSE2(i64 *I64_RESTRICT out,
+		const i64 *I64_RESTRICT a, const i64 *I64_RESTRICT b, size_t n);
+I64_API void i64_multiplyArrayAVX2(i64 *I64_RESTRICT out,
+		const i64 *I64_RESTRICT a, const i64 *I64_RESTRICT b, size_t n);
+
+/* Structure-of-arrays kernels */
+I64_API void i64_soaAddSSE2(const i64_soa *out, const i64_soa *a,
+		const i64_soa *b);
+I64_API void i64_soaSubtractSSE2(const i64_soa *out, const i64_soa *a,
+		const i64_soa *b);
+I64_API void i64_soaAddAVX2(const i64_soa *out, const i64_soa *a,
+		const i64_soa *b);
+I64_API void i64_soaSubtractAVX2(const i64_soa *out, const i64_soa *a,
+		const i64_soa *b);
+
+/* Comparison kernels */
+I64_API void i64_compareArrayToMaskSSE2(const i64 *I64_RESTRICT a,
+		const i64 *I64_RESTRICT b, size_t n, int predicate,
+		unsigned char *I64_RESTRICT mask);
+I64_API void i64_compareScalarArrayToMaskSSE2(const i64 *I64_RESTRICT a, i64 b,
+		size_t n, int predicate, unsigned char *I64_RESTRICT mask);
+I64_API void i64_compareArrayToMaskAVX2(const i64 *I64_RESTRICT a,
+		const i64 *I64_RESTRICT b, size_t n, int predicate,
+		unsigned char *I64_RESTRICT mask);
+I64_API void i64_compareScalarArrayToMaskAVX2(const i64 *I64_RESTRICT a, i64 b,
+		size_t n, int predicate, unsigned char *I64_RESTRICT mask);
+
+/* Filter kernels */
+I64_API size_t i64_filterRangeSSE2(const i64 *I64_RESTRICT a, size_t n, i64 lo,
+		i64 hi, u32 *I64_RESTRICT sel);
+I64_API size_t i64_filterEqualsSSE2(const i64 *I64_RESTRICT a, size_t n,
+		i64 value, u32 *I64_RESTRICT sel);
+I64_API size_t i64_filterNotEqualsSSE2(const i64 *I64_RESTRICT a, size_t n,
+		i64 value, u32 *I64_RESTRICT sel);
+I64_API size_t i64_filterRangeAVX2(const i64 *I64_RESTRICT a, size_t n, i64 lo,
+		i64 hi, u32 *I64_RESTRICT sel);
+I64_API size_t i64_filterEqualsAVX2(const i64 *I64_RESTRICT a, size_t n,
+		i64 value, u32 *I64_RESTRICT sel);
+I64_API size_t i64_filterNotEqualsAVX2(const i64 *I64_RESTRICT a, size_t n,
+		i64 value, u32 *I64_RESTRICT sel);
+
+/* Conversion kernels */
+I64_API void i64_toDoubleArraySSE2(double *I64_RESTRICT out,
+		const i64 *I64_RESTRICT a, size_t n);
+I64_API void i64_toDoubleArrayAVX2(double *I64_RESTRICT out,
+		const i64 *I64_RESTRICT a, size_t n);
+#endif /* I64_SIMD_X86 */
+
+/* Dispatch */
+extern i64_kernelTable i64_kernels;
+I64_API int i64_detectSimdLevel(void);
+I64_API int i64_getSimdLevel(void);
+I64_API int i64_setSimdLevel(int level);
+I64_API int i64_initKernels(void);
+#endif /* I64_DEFINE_ */
+
+#endif
@@ -2,15 +2,37 @@
 	test.c -- tests for i64.c89.h
 	
 	A straightforward port of Google's original long_test.js.
+	
+	Run the tests against both backends of i64_c89.h:
+		cc -DI64_NO_NATIVE -o test_c89 test.c -lm && ./test_c89
+		cc -DI64_USE_NATIVE -o test_native test.c -lm && ./test_native
+	and the word-carry variant of the C89 backend:
+		cc -DI64_NO_NATIVE -DI64_USE_WORD_CARRY -o test_wc test.c -lm
+	and with the trace hooks compiled in:
+		cc -DI64_ENABLE_TRACE -o test_trace test.c -lm
+	To compile the functions out-of-line, with external linkage:
+		cc -DI64_IMPLEMENTATION -o test_impl test.c -lm
+	To check division by zero falls back rather than aborting:
+		cc -DI64_ASSERT_HANDLER=countAssertFailure -o test_ah test.c -lm
 */
 
+#ifdef I64_ASSERT_HANDLER
+int assertFailures = 0;
+
+void countAssertFailure(const char *expr, const char *file, int line) {
+	assertFailures++;
+}
+#endif
+
 #include "test_data.h"
 #include "i64_c89.h"
+#include "i64_c89_simd.h"
 
 #include <stdio.h>
 #include <assert.h>
 #include <float.h>
 #include <math.h>
+#include <string.h>
 
 #define ARRAY_LEN(a) (sizeof a / sizeof a[0])
 #define ASSERT_EQUALS(x, y) (assert((x) == (y)))
@@ -32,6 +54,7 @@ void testComparisons() {
 			ASSERT_EQUALS(i <= j, i64_lessThanOrEqual(vi, vj));
 			ASSERT_EQUALS(i > j, i64_greaterThan(vi, vj));
 			ASSERT_EQUALS(i >= j, i64_greaterThanOrEqual(vi, vj));
+			ASSERT_EQUALS((i > j) - (i < j), i64_compare(vi, vj));
 		}
     }	
 	
@@ -98,7 +121,7 @@ void testBitOperations() {
 			if(len < 32) {
 				ASSERT_EQUALS(
 					(TEST_BITS[i] << len) | 
-						((i32)(TEST_BITS[i + 1])) >> (32 - len),
+						SHR32F0(TEST_BITS[i + 1], 32 - len),
 					i64_getHighBits(i64_shiftLeft(vi, len))					
 				);
 				ASSERT_EQUALS(
@@ -111,10 +134,20 @@ void testBitOperations() {
 					i64_getHighBits(i64_shiftRight(vi, len))
 				);
 				ASSERT_EQUALS(
-					((i32)TEST_BITS[i + 1]) >> len | 
+					SHR32F0(TEST_BITS[i + 1], len) | 
 						(TEST_BITS[i] << (32 - len)),
 					i64_getLowBits(i64_shiftRight(vi, len))
 				);
+				
+				ASSERT_EQUALS(
+					SHR32F0(TEST_BITS[i], len),
+					i64_getHighBits(i64_shiftRightUnsigned(vi, len))
+				);
+				ASSERT_EQUALS(
+					SHR32F0(TEST_BITS[i + 1], len) | 
+						(TEST_BITS[i] << (32 - len)),
+					i64_getLowBits(i64_shiftRightUnsigned(vi, len))
+				);
 			} else {
 				ASSERT_EQUALS(
 					TEST_BITS[i + 1] << (len - 32),
@@ -134,6 +167,10 @@ void testBitOperations() {
 					i64_getLowBits(i64_shiftRight(vi, len))
 				);
 				
+				ASSERT_EQUALS(
+					0,
+					i64_getHighBits(i64_shiftRightUnsigned(vi, len))
+				);
 				if(len == 32) {
 					ASSERT_EQUALS(
 						TEST_BITS[i],
@@ -141,7 +178,7 @@ void testBitOperations() {
 					);
 				} else {
 					ASSERT_EQUALS(
-						((i32)TEST_BITS[i]) >> (len - 32),
+						SHR32F0(TEST_BITS[i], len - 32),
 						i64_getLowBits(i64_shiftRightUnsigned(vi, len))
 					);
 				}
@@ -151,27 +188,176 @@ void testBitOperations() {
 	printf("testBitOperations: all tests good\n");
 }
 
+/*
+	Test the rotates, and the constant-amount shifts
+	and rotates, against the variable shifts.
+*/
+void testRotates() {
+	int i, len;
+	i64 vi;
+	
+	#define CHECK_CONST_SHIFTS(n) \
+		ASSERT_I64_EQUALS(i64_shiftLeft(vi, n), I64_SHL_CONST(vi, n)); \
+		ASSERT_I64_EQUALS(i64_shiftRight(vi, n), I64_SHR_CONST(vi, n)); \
+		ASSERT_I64_EQUALS(i64_shiftRightUnsigned(vi, n), \
+			I64_SHRU_CONST(vi, n)); \
+		ASSERT_I64_EQUALS(i64_rotateLeft(vi, n), I64_ROTL_CONST(vi, n)); \
+		ASSERT_I64_EQUALS(i64_rotateRight(vi, n), I64_ROTR_CONST(vi, n));
+	
+	for(i = 0; i < ARRAY_LEN(TEST_BITS); i += 2) {
+		printf("testRotates: test id %d\n", i);
+		vi = i64_fromBits(TEST_BITS[i + 1], TEST_BITS[i]);
+		for(len = -64; len <= 64; len++) {
+			ASSERT_I64_EQUALS(
+				i64_or(i64_shiftLeft(vi, len & 63),
+					i64_shiftRightUnsigned(vi, (64 - len) & 63)),
+				i64_rotateLeft(vi, len));
+			ASSERT_I64_EQUALS(i64_rotateLeft(vi, -len),
+				i64_rotateRight(vi, len));
+		}
+		CHECK_CONST_SHIFTS(0);
+		CHECK_CONST_SHIFTS(1);
+		CHECK_CONST_SHIFTS(13);
+		CHECK_CONST_SHIFTS(31);
+		CHECK_CONST_SHIFTS(32);
+		CHECK_CONST_SHIFTS(33);
+		CHECK_CONST_SHIFTS(47);
+		CHECK_CONST_SHIFTS(63);
+	}
+	printf("testRotates: all tests good\n");
+}
+
+/*
+	Test the bit scans against bit-by-bit loops
+	(and getNumBitsAbs against goog.math.Long's).
+*/
+void testBitScans() {
+	int i, bit, leading, trailing, count, numBitsAbs;
+	i64 vi, abs;
+	
+	for(i = 0; i < ARRAY_LEN(TEST_BITS); i += 2) {
+		printf("testBitScans: test id %d\n", i);
+		vi = i64_fromBits(TEST_BITS[i + 1], TEST_BITS[i]);
+		leading = 64;
+		trailing = 64;
+		count = 0;
+		for(bit = 0; bit < 64; bit++) {
+			if(i64_isOdd(i64_shiftRightUnsigned(vi, bit))) {
+				leading = 63 - bit;
+				trailing = (trailing == 64) ? bit : trailing;
+				count++;
+			}
+		}
+		ASSERT_EQUALS(leading, i64_numberOfLeadingZeros(vi));
+		ASSERT_EQUALS(trailing, i64_numberOfTrailingZeros(vi));
+		ASSERT_EQUALS(count, i64_bitCount(vi));
+		
+		abs = i64_isNegative(vi) ? i64_negate(vi) : vi;
+		numBitsAbs = 1;
+		for(bit = 1; bit < 64; bit++) {
+			if(i64_isOdd(i64_shiftRightUnsigned(abs, bit))) {
+				numBitsAbs = bit + 1;
+			}
+		}
+		ASSERT_EQUALS(numBitsAbs, i64_getNumBitsAbs(vi));
+	}
+	ASSERT_EQUALS(64, i64_numberOfLeadingZeros(i64_getZero()));
+	ASSERT_EQUALS(64, i64_numberOfTrailingZeros(i64_getZero()));
+	ASSERT_EQUALS(1, i64_getNumBitsAbs(i64_getZero()));
+	ASSERT_EQUALS(64, i64_getNumBitsAbs(i64_getMinValue()));
+	printf("testBitScans: all tests good\n");
+}
+
 
-/* Test division and modulus. 
+/* Test division and modulus. */
 void testDivMod() {
-	int i, j;
-	i64 vi, vj, divResult, modResult;
-	int countPerDivMod, countPerDivModCall;
+	int i, j, count;
+	i64 vi, vj, divResult, modResult, fusedMod;
 	
+	count = 0;
+	/* count essentially indexes into an array of precomputed
+		results (TEST_DIV_BITS); zero divisors have no entry. */
 	
 	for(i = 0; i < ARRAY_LEN(TEST_BITS); i += 2) {
 		vi = i64_fromBits(TEST_BITS[i + 1], TEST_BITS[i]);
 		for(j = 0; j < ARRAY_LEN(TEST_BITS); j += 2) {
-			printf("testDivMOd: test id %d, %d\n", i, j);
+			printf("testDivMod: test id %d, %d\n", i, j);
 			vj = i64_fromBits(TEST_BITS[j + 1], TEST_BITS[j]);
+			if(i64_isZero(vj)) {
+				continue;
+			}
+			divResult = i64_div(vi, vj);
+			ASSERT_EQUALS(
+				TEST_DIV_BITS[count++], i64_getHighBits(divResult)
+			);
+			ASSERT_EQUALS(
+				TEST_DIV_BITS[count++], i64_getLowBits(divResult)
+			);
+			
+			modResult = i64_modulo(vi, vj);
+			ASSERT_I64_EQUALS(vi,
+				i64_add(i64_multiply(divResult, vj), modResult));
 			
+			/* the fused form agrees with the separate ones. */
+			ASSERT_I64_EQUALS(divResult, i64_DivMod(vi, vj, &fusedMod));
+			ASSERT_I64_EQUALS(modResult, fusedMod);
 		}
 	}
+	ASSERT_EQUALS(ARRAY_LEN(TEST_DIV_BITS), count);
 	
 	printf("testDivMod: all tests good\n");
 }
 
-*/
+/* Test division by precomputed i64_divisors. */
+void testDivisor() {
+	int i, j, count;
+	i64 vi, vj;
+	i64_divisor dj;
+	
+	count = 0;
+	/* walk TEST_DIV_BITS in the same order as testDivMod,
+		so loop over divisors on the outside. */
+	for(j = 0; j < ARRAY_LEN(TEST_BITS); j += 2) {
+		vj = i64_fromBits(TEST_BITS[j + 1], TEST_BITS[j]);
+		if(i64_isZero(vj)) {
+			continue;
+		}
+		dj = i64_makeDivisor(vj);
+		for(i = 0; i < ARRAY_LEN(TEST_BITS); i += 2) {
+			printf("testDivisor: test id %d, %d\n", i, j);
+			vi = i64_fromBits(TEST_BITS[i + 1], TEST_BITS[i]);
+			ASSERT_I64_EQUALS(i64_div(vi, vj), i64_divByDivisor(vi, &dj));
+			ASSERT_I64_EQUALS(i64_modulo(vi, vj), i64_modByDivisor(vi, &dj));
+			count++;
+		}
+	}
+	ASSERT_EQUALS(ARRAY_LEN(TEST_DIV_BITS), count * 2);
+	
+	printf("testDivisor: all tests good\n");
+}
+
+#ifdef I64_ASSERT_HANDLER
+/* Test division by zero reaches the handler, then falls back */
+void testDivideByZero() {
+	i64 num = i64_fromInt(-12345), rem;
+	i64_divisor d;
+	printf("testDivideByZero\n");
+	assertFailures = 0;
+	ASSERT_I64_EQUALS(i64_getZero(), i64_DivMod(num, i64_getZero(), &rem));
+	ASSERT_I64_EQUALS(num, rem);
+	assert(assertFailures > 0);
+	assertFailures = 0;
+	ASSERT_I64_EQUALS(i64_getZero(),
+		i64_DivModUnsigned(num, i64_getZero(), &rem));
+	ASSERT_I64_EQUALS(num, rem);
+	assert(assertFailures > 0);
+	assertFailures = 0;
+	d = i64_makeDivisor(i64_getZero());
+	assert(assertFailures > 0);
+	ASSERT_I64_EQUALS(i64_getZero(), i64_divByDivisor(num, &d));
+	printf("testDivideByZero: all tests good\n");
+}
+#endif
 
 /* test i64_isZero. */
 void testIsZero() {
@@ -336,6 +522,780 @@ void testMultiply() {	int i, j, count;
 	printf("testMultiply: all tests good\n");
 }
 
+/*
+	Test i64_multiplyFull and friends, which
+	goog.math.Long lacks.
+*/
+void testMultiplyFull() {
+	int i, j, count;
+	i64 vi, vj, low, high, highUnsigned;
+	
+	count = 0;
+	/* count indexes into both TEST_MUL_BITS (low halves)
+		and TEST_MULHI_BITS (high halves). */
+	
+	for(i = 0; i < ARRAY_LEN(TEST_BITS); i += 2) {
+		vi = i64_fromBits(TEST_BITS[i + 1], TEST_BITS[i]);
+		for(j = 0; j < ARRAY_LEN(TEST_BITS); j += 2) {
+			printf("testMultiplyFull: test id %d, %d\n", i, j);
+			vj = i64_fromBits(TEST_BITS[j + 1], TEST_BITS[j]);
+			low = i64_multiplyFull(vi, vj, &high);
+			ASSERT_EQUALS(TEST_MUL_BITS[count], i64_getHighBits(low));
+			ASSERT_EQUALS(TEST_MULHI_BITS[count++], i64_getHighBits(high));
+			ASSERT_EQUALS(TEST_MUL_BITS[count], i64_getLowBits(low));
+			ASSERT_EQUALS(TEST_MULHI_BITS[count++], i64_getLowBits(high));
+			ASSERT_I64_EQUALS(high, i64_multiplyHigh(vi, vj));
+			
+			/* reading a negative operand as unsigned adds
+				2^64 times the other operand */
+			highUnsigned = i64_multiplyHighUnsigned(vi, vj);
+			if(i64_isNegative(vi)) {
+				high = i64_add(high, vj);
+			}
+			if(i64_isNegative(vj)) {
+				high = i64_add(high, vi);
+			}
+			ASSERT_I64_EQUALS(high, highUnsigned);
+			ASSERT_I64_EQUALS(low, i64_multiplyFullUnsigned(vi, vj, &high));
+			ASSERT_I64_EQUALS(highUnsigned, high);
+		}
+	}
+	printf("testMultiplyFull: all tests good\n");
+}
+
+/*
+	Test the array operations against their scalar
+	counterparts, over every pair of TEST_BITS.
+*/
+#define NUM_TEST_PAIRS ((ARRAY_LEN(TEST_BITS) / 2) * (ARRAY_LEN(TEST_BITS) / 2))
+#define NUM_MASK_BYTES ((NUM_TEST_PAIRS + 7) / 8)
+
+int PREDICATES[] = {
+	I64_CMP_LT, I64_CMP_LE, I64_CMP_GT, I64_CMP_GE, I64_CMP_EQ, I64_CMP_NE
+};
+
+/* 'a predicate b', through the scalar comparisons. */
+int predicateHolds(i64 a, i64 b, int predicate) {
+	switch(predicate) {
+	case I64_CMP_LT: return i64_lessThan(a, b);
+	case I64_CMP_LE: return i64_lessThanOrEqual(a, b);
+	case I64_CMP_GT: return i64_greaterThan(a, b);
+	case I64_CMP_GE: return i64_greaterThanOrEqual(a, b);
+	case I64_CMP_EQ: return i64_equals(a, b);
+	default: return i64_notEquals(a, b);
+	}
+}
+
+#define MASK_BIT(mask, i) (((mask)[(i) / 8] >> ((i) % 8)) & 1)
+
+/*
+	Checks a selection vector of 'count' indices against
+	'holds', evaluated for each i over [0, n).
+*/
+#define CHECK_SELECTION(sel, count, n, holds) { \
+		int selected_ = 0; \
+		for(i = 0; i < (n); i++) { \
+			if(holds) { \
+				ASSERT_EQUALS(i, (sel)[selected_]); \
+				selected_++; \
+			} \
+		} \
+		ASSERT_EQUALS(selected_, (count)); \
+	}
+
+/*
+	Fills 'as' and 'bs' with every pair of TEST_BITS
+	values, and returns how many pairs (NUM_TEST_PAIRS).
+*/
+int makeTestPairs(i64 *as, i64 *bs) {
+	int i, j, k = 0;
+	for(i = 0; i < ARRAY_LEN(TEST_BITS); i += 2) {
+		for(j = 0; j < ARRAY_LEN(TEST_BITS); j += 2) {
+			as[k] = i64_fromBits(TEST_BITS[i + 1], TEST_BITS[i]);
+			bs[k] = i64_fromBits(TEST_BITS[j + 1], TEST_BITS[j]);
+			k++;
+		}
+	}
+	return k;
+}
+
+/* Checks out[i] against 'expected', evaluated for each i over [0, n). */
+#define CHECK_ELEMENTS(out, n, expected) \
+	for(i = 0; i < (n); i++) { \
+		ASSERT_I64_EQUALS((expected), (out)[i]); \
+	}
+
+/*
+	Runs 'call', which leaves its results in 'out', and checks
+	them against 'scalarOp' over the first k pairs of as[], bs[]
+	(or over as[], at every shift amount 'len').
+*/
+#define CHECK_BINARY(call, scalarOp) \
+	call; \
+	CHECK_ELEMENTS(out, k, scalarOp(as[i], bs[i]))
+#define CHECK_SHIFT(call, scalarOp) \
+	for(len = -64; len <= 64; len++) { \
+		call; \
+		CHECK_ELEMENTS(out, k, scalarOp(as[i], len)); \
+	}
+
+void testArrays() {
+	static i64 as[NUM_TEST_PAIRS], bs[NUM_TEST_PAIRS], out[NUM_TEST_PAIRS];
+	static unsigned char mask[NUM_MASK_BYTES];
+	static u32 sel[NUM_TEST_PAIRS];
+	static double doubles[NUM_TEST_PAIRS];
+	size_t count;
+	int i, j, k, p, len;
+	
+	k = makeTestPairs(as, bs);
+	
+	#define CHECK_SCALAR_ARRAY(arrayOp, scalarOp) \
+		for(j = 0; j < k; j += 37) { \
+			arrayOp(out, as, bs[j], k); \
+			CHECK_ELEMENTS(out, k, scalarOp(as[i], bs[j])); \
+		}
+	
+	printf("testArrays: binary operations\n");
+	CHECK_BINARY(i64_addArray(out, as, bs, k), i64_add);
+	CHECK_BINARY(i64_subtractArray(out, as, bs, k), i64_subtract);
+	CHECK_BINARY(i64_multiplyArray(out, as, bs, k), i64_multiply);
+	CHECK_BINARY(i64_andArray(out, as, bs, k), i64_and);
+	CHECK_BINARY(i64_orArray(out, as, bs, k), i64_or);
+	CHECK_BINARY(i64_xorArray(out, as, bs, k), i64_xor);
+	
+	printf("testArrays: scalar-broadcast operations\n");
+	CHECK_SCALAR_ARRAY(i64_addScalarArray, i64_add);
+	CHECK_SCALAR_ARRAY(i64_subtractScalarArray, i64_subtract);
+	CHECK_SCALAR_ARRAY(i64_multiplyScalarArray, i64_multiply);
+	CHECK_SCALAR_ARRAY(i64_andScalarArray, i64_and);
+	CHECK_SCALAR_ARRAY(i64_orScalarArray, i64_or);
+	CHECK_SCALAR_ARRAY(i64_xorScalarArray, i64_xor);
+	
+	printf("testArrays: unary operations\n");
+	i64_negateArray(out, as, k);
+	CHECK_ELEMENTS(out, k, i64_negate(as[i]));
+	i64_notArray(out, as, k);
+	CHECK_ELEMENTS(out, k, i64_not(as[i]));
+	
+	printf("testArrays: shifts\n");
+	CHECK_SHIFT(i64_shiftLeftArray(out, as, len, k), i64_shiftLeft);
+	CHECK_SHIFT(i64_shiftRightArray(out, as, len, k), i64_shiftRight);
+	CHECK_SHIFT(i64_shiftRightUnsignedArray(out, as, len, k),
+		i64_shiftRightUnsigned);
+	
+	printf("testArrays: conversions\n");
+	i64_toDoubleArray(doubles, as, k);
+	for(i = 0; i < k; i++) {
+		ASSERT_EQUALS(i64_toDouble(as[i]), doubles[i]);
+	}
+	
+	printf("testArrays: comparison masks\n");
+	for(p = 0; p < ARRAY_LEN(PREDICATES); p++) {
+		/* an odd length, so the last byte is partial */
+		i64_compareArrayToMask(as, bs, k - 3, PREDICATES[p], mask);
+		for(i = 0; i < k - 3; i++) {
+			ASSERT_EQUALS(predicateHolds(as[i], bs[i], PREDICATES[p]),
+				MASK_BIT(mask, i));
+		}
+		ASSERT_EQUALS(0, mask[(k - 4) / 8] >> ((k - 4) % 8 + 1));
+		for(j = 0; j < k; j += 37) {
+			i64_compareScalarArrayToMask(as, bs[j], k, PREDICATES[p], mask);
+			for(i = 0; i < k; i++) {
+				ASSERT_EQUALS(predicateHolds(as[i], bs[j], PREDICATES[p]),
+					MASK_BIT(mask, i));
+			}
+		}
+	}
+	
+	printf("testArrays: filters\n");
+	for(j = 0; j + 1 < k; j += 37) {
+		count = i64_filterRange(as, k, bs[j], bs[j + 1], sel);
+		CHECK_SELECTION(sel, count, k,
+			i64_greaterThanOrEqual(as[i], bs[j]) & i64_lessThan(as[i], bs[j + 1]));
+		count = i64_filterEquals(as, k, bs[j], sel);
+		CHECK_SELECTION(sel, count, k, i64_equals(as[i], bs[j]));
+		count = i64_filterNotEquals(as, k, bs[j], sel);
+		CHECK_SELECTION(sel, count, k, i64_notEquals(as[i], bs[j]));
+	}
+	
+	printf("testArrays: all tests good\n");
+}
+
+/*
+	Test the structure-of-arrays columns against the
+	scalar operations, over every pair of TEST_BITS.
+*/
+void testSoa() {
+	static i64 as[NUM_TEST_PAIRS], bs[NUM_TEST_PAIRS], out[NUM_TEST_PAIRS];
+	static i32 words[6][NUM_TEST_PAIRS];
+	static int cmp[NUM_TEST_PAIRS];
+	i64_soa a, b, o;
+	int i, k, len;
+	
+	k = makeTestPairs(as, bs);
+	a.low = words[0]; a.high = words[1]; a.length = k;
+	b.low = words[2]; b.high = words[3]; b.length = k;
+	o.low = words[4]; o.high = words[5]; o.length = k;
+	i64_soaFromArray(&a, as);
+	i64_soaFromArray(&b, bs);
+	i64_soaToArray(out, &a);
+	CHECK_ELEMENTS(out, k, as[i]);
+	
+	/* runs a column operation into 'o', and gathers it into 'out' */
+	#define SOA_TO_OUT(call) (call, i64_soaToArray(out, &o))
+	
+	printf("testSoa: binary operations\n");
+	CHECK_BINARY(SOA_TO_OUT(i64_soaAdd(&o, &a, &b)), i64_add);
+	CHECK_BINARY(SOA_TO_OUT(i64_soaSubtract(&o, &a, &b)), i64_subtract);
+	CHECK_BINARY(SOA_TO_OUT(i64_soaAnd(&o, &a, &b)), i64_and);
+	CHECK_BINARY(SOA_TO_OUT(i64_soaOr(&o, &a, &b)), i64_or);
+	CHECK_BINARY(SOA_TO_OUT(i64_soaXor(&o, &a, &b)), i64_xor);
+	
+	SOA_TO_OUT(i64_soaNot(&o, &a));
+	CHECK_ELEMENTS(out, k, i64_not(as[i]));
+	
+	printf("testSoa: comparisons\n");
+	i64_soaCompare(cmp, &a, &b);
+	for(i = 0; i < k; i++) {
+		ASSERT_EQUALS(i64_compare(as[i], bs[i]), cmp[i]);
+	}
+	
+	printf("testSoa: shifts\n");
+	CHECK_SHIFT(SOA_TO_OUT(i64_soaShiftLeft(&o, &a, len)), i64_shiftLeft);
+	CHECK_SHIFT(SOA_TO_OUT(i64_soaShiftRight(&o, &a, len)), i64_shiftRight);
+	CHECK_SHIFT(SOA_TO_OUT(i64_soaShiftRightUnsigned(&o, &a, len)),
+		i64_shiftRightUnsigned);
+	
+	printf("testSoa: all tests good\n");
+}
+
+#ifdef I64_SIMD_X86
+/*
+	Test the SSE2 and AVX2 kernels for bit-exactness
+	against the scalar array operations, over every pair
+	of TEST_BITS, and at every length up to 9 (to cover
+	the scalar tails).
+*/
+void testSimd() {
+	static i64 as[NUM_TEST_PAIRS], bs[NUM_TEST_PAIRS];
+	static i64 expected[NUM_TEST_PAIRS], out[NUM_TEST_PAIRS];
+	static i32 words[6][NUM_TEST_PAIRS];
+	static unsigned char expectedMask[NUM_MASK_BYTES], mask[NUM_MASK_BYTES];
+	static u32 expectedSel[NUM_TEST_PAIRS], sel[NUM_TEST_PAIRS];
+	static double expectedDoubles[NUM_TEST_PAIRS], doubles[NUM_TEST_PAIRS];
+	size_t count;
+	i64_soa a, b, o;
+	int i, j, k, n, p;
+	
+	k = makeTestPairs(as, bs);
+	a.low = words[0]; a.high = words[1];
+	b.low = words[2]; b.high = words[3];
+	o.low = words[4]; o.high = words[5];
+	a.length = b.length = o.length = k;
+	i64_soaFromArray(&a, as);
+	i64_soaFromArray(&b, bs);
+	
+	/* every length up to 'tail', then k */
+	#define FOR_LENGTHS(tail) \
+		for(n = 0; n <= k; n = (n < (tail)) ? n + 1 : k + (n == k))
+	
+	/*
+		Runs the scalar array operation into 'expected' and
+		the kernel into 'out', at each length, and compares.
+	*/
+	#define CHECK_KERNEL(scalarCall, simdCall) \
+		FOR_LENGTHS(9) { \
+			scalarCall; \
+			simdCall; \
+			CHECK_ELEMENTS(out, n, expected[i]); \
+		}
+	#define CHECK_KERNEL_BINARY(scalarOp, simdOp) \
+		CHECK_KERNEL(scalarOp(expected, as, bs, n), simdOp(out, as, bs, n))
+	#define CHECK_KERNEL_UNARY(scalarOp, simdOp) \
+		CHECK_KERNEL(scalarOp(expected, as, n), simdOp(out, as, n))
+	#define CHECK_KERNEL_SOA(scalarOp, simdOp) \
+		CHECK_KERNEL(scalarOp(expected, as, bs, n), \
+			(a.length = b.length = o.length = n, simdOp(&o, &a, &b), \
+				i64_soaToArray(out, &o)))
+	
+	#define CHECK_KERNEL_MASKS(simdOp, simdOpB) \
+		for(p = 0; p < ARRAY_LEN(PREDICATES); p++) { \
+			FOR_LENGTHS(17) { \
+				i64_compareArrayToMask(as, bs, n, PREDICATES[p], expectedMask); \
+				simdOp(as, bs, n, PREDICATES[p], mask); \
+				for(i = 0; i < (n + 7) / 8; i++) { \
+					ASSERT_EQUALS(expectedMask[i], mask[i]); \
+				} \
+				i64_compareScalarArrayToMask(as, bs[n / 2], n, PREDICATES[p], \
+					expectedMask); \
+				simdOpB(as, bs[n / 2], n, PREDICATES[p], mask); \
+				for(i = 0; i < (n + 7) / 8; i++) { \
+					ASSERT_EQUALS(expectedMask[i], mask[i]); \
+				} \
+			} \
+		}
+	#define CHECK_KERNEL_FILTER(scalarCall, simdCall) \
+		FOR_LENGTHS(9) { \
+			for(j = 0; j + 1 < k; j += 97) { \
+				count = scalarCall; \
+				ASSERT_EQUALS(count, simdCall); \
+				for(i = 0; i < count; i++) { \
+					ASSERT_EQUALS(expectedSel[i], sel[i]); \
+				} \
+			} \
+		}
+	
+	/* Every kernel with the given suffix. */
+	#define CHECK_SIMD_KERNELS(suffix) \
+		CHECK_KERNEL_BINARY(i64_addArray, i64_addArray##suffix); \
+		CHECK_KERNEL_BINARY(i64_subtractArray, i64_subtractArray##suffix); \
+		CHECK_KERNEL_BINARY(i64_multiplyArray, i64_multiplyArray##suffix); \
+		i64_multiplyArray##suffix(out, as, bs, k); \
+		for(i = 0; i < k; i++) { \
+			ASSERT_EQUALS(TEST_MUL_BITS[2 * i], i64_getHighBits(out[i])); \
+			ASSERT_EQUALS(TEST_MUL_BITS[2 * i + 1], i64_getLowBits(out[i])); \
+		} \
+		CHECK_KERNEL_BINARY(i64_andArray, i64_andArray##suffix); \
+		CHECK_KERNEL_BINARY(i64_orArray, i64_orArray##suffix); \
+		CHECK_KERNEL_BINARY(i64_xorArray, i64_xorArray##suffix); \
+		CHECK_KERNEL_UNARY(i64_negateArray, i64_negateArray##suffix); \
+		CHECK_KERNEL_UNARY(i64_notArray, i64_notArray##suffix); \
+		CHECK_KERNEL_SOA(i64_addArray, i64_soaAdd##suffix); \
+		CHECK_KERNEL_SOA(i64_subtractArray, i64_soaSubtract##suffix); \
+		CHECK_KERNEL_MASKS(i64_compareArrayToMask##suffix, \
+			i64_compareScalarArrayToMask##suffix); \
+		CHECK_KERNEL_FILTER( \
+			i64_filterRange(as, n, bs[j], bs[j + 1], expectedSel), \
+			i64_filterRange##suffix(as, n, bs[j], bs[j + 1], sel)); \
+		CHECK_KERNEL_FILTER( \
+			i64_filterEquals(as, n, as[j], expectedSel), \
+			i64_filterEquals##suffix(as, n, as[j], sel)); \
+		CHECK_KERNEL_FILTER( \
+			i64_filterNotEquals(as, n, as[j], expectedSel), \
+			i64_filterNotEquals##suffix(as, n, as[j], sel)); \
+		FOR_LENGTHS(9) { \
+			i64_toDoubleArray(expectedDoubles, as, n); \
+			i64_toDoubleArray##suffix(doubles, as, n); \
+			for(i = 0; i < n; i++) { \
+				ASSERT_EQUALS(expectedDoubles[i], doubles[i]); \
+			} \
+		}
+	
+	printf("testSimd: SSE2 kernels\n");
+	CHECK_SIMD_KERNELS(SSE2);
+	
+	if(i64_detectSimdLevel() >= I64_SIMD_AVX2) {
+		printf("testSimd: AVX2 kernels\n");
+		CHECK_SIMD_KERNELS(AVX2);
+	} else {
+		printf("testSimd: no AVX2 on this CPU; skipping its kernels\n");
+	}
+	
+	printf("testSimd: all tests good\n");
+}
+#endif
+
+/*
+	Test the i64_kernels dispatch table at every kernel
+	level this CPU supports, forcing each in turn.
+*/
+void testDispatch() {
+	static i64 as[NUM_TEST_PAIRS], bs[NUM_TEST_PAIRS];
+	static i64 out[NUM_TEST_PAIRS];
+	int i, k, level;
+	
+	k = makeTestPairs(as, bs);
+	
+	/* Every entry of i64_kernels, named by KERNEL(scalar name). */
+	#define CHECK_KERNEL_TABLE(KERNEL) \
+		ASSERT_EQUALS(KERNEL(i64_addArray), i64_kernels.addArray); \
+		ASSERT_EQUALS(KERNEL(i64_subtractArray), i64_kernels.subtractArray); \
+		ASSERT_EQUALS(KERNEL(i64_multiplyArray), i64_kernels.multiplyArray); \
+		ASSERT_EQUALS(KERNEL(i64_negateArray), i64_kernels.negateArray); \
+		ASSERT_EQUALS(KERNEL(i64_andArray), i64_kernels.andArray); \
+		ASSERT_EQUALS(KERNEL(i64_orArray), i64_kernels.orArray); \
+		ASSERT_EQUALS(KERNEL(i64_xorArray), i64_kernels.xorArray); \
+		ASSERT_EQUALS(KERNEL(i64_notArray), i64_kernels.notArray); \
+		ASSERT_EQUALS(KERNEL(i64_soaAdd), i64_kernels.soaAdd); \
+		ASSERT_EQUALS(KERNEL(i64_soaSubtract), i64_kernels.soaSubtract); \
+		ASSERT_EQUALS(KERNEL(i64_compareArrayToMask), \
+			i64_kernels.compareArrayToMask); \
+		ASSERT_EQUALS(KERNEL(i64_compareScalarArrayToMask), \
+			i64_kernels.compareScalarArrayToMask); \
+		ASSERT_EQUALS(KERNEL(i64_filterRange), i64_kernels.filterRange); \
+		ASSERT_EQUALS(KERNEL(i64_filterEquals), i64_kernels.filterEquals); \
+		ASSERT_EQUALS(KERNEL(i64_filterNotEquals), \
+			i64_kernels.filterNotEquals); \
+		ASSERT_EQUALS(KERNEL(i64_toDoubleArray), i64_kernels.toDoubleArray);
+	#define SCALAR_KERNEL(f) f
+	#define SSE2_KERNEL(f) f##SSE2
+	#define AVX2_KERNEL(f) f##AVX2
+	
+	ASSERT_EQUALS(i64_detectSimdLevel(), i64_initKernels());
+	ASSERT_EQUALS(i64_detectSimdLevel(), i64_getSimdLevel());
+	/* we can't force a level beyond what the CPU supports */
+	ASSERT_EQUALS(i64_detectSimdLevel(), i64_setSimdLevel(I64_SIMD_AVX2 + 1));
+	ASSERT_EQUALS(I64_SIMD_NONE, i64_setSimdLevel(I64_SIMD_NONE - 1));
+	CHECK_KERNEL_TABLE(SCALAR_KERNEL);
+	
+	for(level = I64_SIMD_NONE; level <= i64_detectSimdLevel(); level++) {
+		printf("testDispatch: level %d\n", level);
+		ASSERT_EQUALS(level, i64_setSimdLevel(level));
+		ASSERT_EQUALS(level, i64_getSimdLevel());
+		if(level == I64_SIMD_NONE) {
+			CHECK_KERNEL_TABLE(SCALAR_KERNEL);
+		}
+#ifdef I64_SIMD_X86
+		if(level == I64_SIMD_SSE2) {
+			CHECK_KERNEL_TABLE(SSE2_KERNEL);
+		}
+		if(level == I64_SIMD_AVX2) {
+			CHECK_KERNEL_TABLE(AVX2_KERNEL);
+		}
+#endif
+		/* testSimd covers the kernels; just call through the table */
+		CHECK_BINARY(i64_kernels.addArray(out, as, bs, k), i64_add);
+	}
+	i64_initKernels();
+	
+	printf("testDispatch: all tests good\n");
+}
+
+/*
+	The digits of 'val' in 'radix', by repeated unsigned
+	division -- slow, but independent of i64_toString.
+*/
+void referenceString(i64 val, int radix, int isUnsigned, char *strOut) {
+	char digits[I64_MAX_STRING_LENGTH];
+	i64 rem;
+	int len = 0, neg = !isUnsigned && i64_isNegative(val);
+	
+	if(neg) {
+		val = i64_negate(val);
+		*strOut++ = '-';
+	}
+	do {
+		val = i64_DivModUnsigned(val, i64_fromInt(radix), &rem);
+		digits[len++] = "0123456789abcdefghijklmnopqrstuvwxyz"[rem.low_];
+	} while(!i64_isZero(val));
+	while(len > 0) {
+		*strOut++ = digits[--len];
+	}
+	*strOut = 0;
+}
+
+/* Test i64_toString and i64_fromString, in every radix. */
+void testToFromString() {
+	char str[I64_MAX_STRING_LENGTH], expected[I64_MAX_STRING_LENGTH];
+	int i, radix, status;
+	i64 vi;
+	
+	for(i = 0; i < ARRAY_LEN(TEST_BITS); i += 2) {
+		printf("testToFromString: test id %d\n", i);
+		vi = i64_fromBits(TEST_BITS[i + 1], TEST_BITS[i]);
+		ASSERT_EQUALS(I64_TOFROMSTR_SUCC, i64_toString(vi, 10, str, sizeof str));
+		ASSERT_EQUALS(0, strcmp(TEST_STRINGS[i / 2], str));
+		
+		ASSERT_I64_EQUALS(vi,
+			i64_fromString(10, str, strlen(str), &status));
+		ASSERT_EQUALS(I64_TOFROMSTR_SUCC, status);
+		
+		for(radix = 2; radix <= 36; radix++) {
+			ASSERT_EQUALS(I64_TOFROMSTR_SUCC,
+				i64_toString(vi, radix, str, sizeof str));
+			referenceString(vi, radix, 0, expected);
+			ASSERT_EQUALS(0, strcmp(expected, str));
+			ASSERT_I64_EQUALS(vi,
+				i64_fromString(radix, str, strlen(str), &status));
+			ASSERT_EQUALS(I64_TOFROMSTR_SUCC, status);
+		}
+		
+		/* exactly enough room, and one byte too few */
+		ASSERT_EQUALS(I64_TOFROMSTR_SUCC,
+			i64_toString(vi, 10, str, strlen(TEST_STRINGS[i / 2]) + 1));
+		ASSERT_EQUALS(I64_TOFROMSTR_FAIL_LENGTH,
+			i64_toString(vi, 10, str, strlen(TEST_STRINGS[i / 2])));
+		ASSERT_EQUALS(0, str[0]);
+	}
+	ASSERT_EQUALS(I64_TOFROMSTR_FAIL_RADIX,
+		i64_toString(i64_getOne(), 1, str, sizeof str));
+	ASSERT_EQUALS(I64_TOFROMSTR_FAIL_RADIX,
+		i64_toString(i64_getOne(), 37, str, sizeof str));
+	
+	#define CHECK_FROM_STRING(radix, s, expectedStatus, expected) \
+		ASSERT_I64_EQUALS(expected, \
+			i64_fromString(radix, s, strlen(s), &status)); \
+		ASSERT_EQUALS(expectedStatus, status);
+	
+	/* the extremes, and one past them */
+	CHECK_FROM_STRING(10, "9223372036854775807",
+		I64_TOFROMSTR_SUCC, i64_getMaxValue());
+	CHECK_FROM_STRING(10, "9223372036854775808",
+		I64_TOFROMSTR_FAIL_RANGE, i64_getZero());
+	CHECK_FROM_STRING(10, "-9223372036854775809",
+		I64_TOFROMSTR_FAIL_RANGE, i64_getZero());
+	CHECK_FROM_STRING(10, "99999999999999999999",
+		I64_TOFROMSTR_FAIL_RANGE, i64_getZero());
+	CHECK_FROM_STRING(10, "184467440737095516150",
+		I64_TOFROMSTR_FAIL_RANGE, i64_getZero());
+	CHECK_FROM_STRING(16, "7fffffffffffffff",
+		I64_TOFROMSTR_SUCC, i64_getMaxValue());
+	CHECK_FROM_STRING(16, "8000000000000000",
+		I64_TOFROMSTR_FAIL_RANGE, i64_getZero());
+	CHECK_FROM_STRING(16, "-8000000000000000",
+		I64_TOFROMSTR_SUCC, i64_getMinValue());
+	CHECK_FROM_STRING(3, "100000000000000000000000000000000000000000",
+		I64_TOFROMSTR_FAIL_RANGE, i64_getZero());
+	
+	/* leading zeros, empty strings and bad digits */
+	CHECK_FROM_STRING(10, "0000000000000000000000000000001",
+		I64_TOFROMSTR_SUCC, i64_getOne());
+	CHECK_FROM_STRING(10, "-0", I64_TOFROMSTR_SUCC, i64_getZero());
+	CHECK_FROM_STRING(10, "", I64_TOFROMSTR_FAIL_DIGIT, i64_getZero());
+	CHECK_FROM_STRING(10, "-", I64_TOFROMSTR_FAIL_DIGIT, i64_getZero());
+	CHECK_FROM_STRING(10, "--1", I64_TOFROMSTR_FAIL_DIGIT, i64_getZero());
+	CHECK_FROM_STRING(10, "12a", I64_TOFROMSTR_FAIL_DIGIT, i64_getZero());
+	CHECK_FROM_STRING(10, "1234567/", I64_TOFROMSTR_FAIL_DIGIT, i64_getZero());
+	CHECK_FROM_STRING(10, "1234567:1234567812345678",
+		I64_TOFROMSTR_FAIL_DIGIT, i64_getZero());
+	CHECK_FROM_STRING(10, "1234567812345678 1234567",
+		I64_TOFROMSTR_FAIL_DIGIT, i64_getZero());
+	CHECK_FROM_STRING(10, "0xfoobar", I64_TOFROMSTR_FAIL_DIGIT, i64_getZero());
+	CHECK_FROM_STRING(2, "102", I64_TOFROMSTR_FAIL_DIGIT, i64_getZero());
+	CHECK_FROM_STRING(37, "1", I64_TOFROMSTR_FAIL_RADIX, i64_getZero());
+	
+	/* testBase36ToString, and either case */
+	CHECK_FROM_STRING(36, "zzzzzz", I64_TOFROMSTR_SUCC,
+		i64_fromBits(0x81BF0FFF, 0));
+	CHECK_FROM_STRING(36, "ZZZZZZ", I64_TOFROMSTR_SUCC,
+		i64_fromBits(0x81BF0FFF, 0));
+	i64_toString(i64_fromString(36, "zzzzzz", 6, NULL), 36, str, sizeof str);
+	ASSERT_EQUALS(0, strcmp("zzzzzz", str));
+	
+	/* testBaseDefaultFromString (the rest of it) */
+	i64_toString(i64_fromBits(1, 0x40000000), 2, str, sizeof str);
+	ASSERT_EQUALS(0, strcmp(
+		"100000000000000000000000000000000000000000000000000000000000001",
+		str));
+	printf("testToFromString: all tests good\n");
+}
+
+/*
+	Test i64_toUnsignedString and i64_fromUnsignedString,
+	in every radix.
+*/
+void testToFromUnsignedString() {
+	char str[I64_MAX_STRING_LENGTH], expected[I64_MAX_STRING_LENGTH];
+	int i, radix, status;
+	i64 vi;
+	
+	for(i = 0; i < ARRAY_LEN(TEST_BITS); i += 2) {
+		printf("testToFromUnsignedString: test id %d\n", i);
+		vi = i64_fromBits(TEST_BITS[i + 1], TEST_BITS[i]);
+		ASSERT_EQUALS(I64_TOFROMSTR_SUCC,
+			i64_toUnsignedString(vi, 10, str, sizeof str));
+		ASSERT_EQUALS(0, strcmp(TEST_UNSIGNED_STRINGS[i / 2], str));
+		ASSERT_I64_EQUALS(vi,
+			i64_fromUnsignedString(10, str, strlen(str), &status));
+		ASSERT_EQUALS(I64_TOFROMSTR_SUCC, status);
+		
+		for(radix = 2; radix <= 36; radix++) {
+			ASSERT_EQUALS(I64_TOFROMSTR_SUCC,
+				i64_toUnsignedString(vi, radix, str, sizeof str));
+			referenceString(vi, radix, 1, expected);
+			ASSERT_EQUALS(0, strcmp(expected, str));
+			ASSERT_I64_EQUALS(vi,
+				i64_fromUnsignedString(radix, str, strlen(str), &status));
+			ASSERT_EQUALS(I64_TOFROMSTR_SUCC, status);
+		}
+	}
+	ASSERT_I64_EQUALS(i64_getNegOne(),
+		i64_fromUnsignedString(10, "18446744073709551615", 20, &status));
+	ASSERT_EQUALS(I64_TOFROMSTR_SUCC, status);
+	ASSERT_I64_EQUALS(i64_getZero(),
+		i64_fromUnsignedString(10, "18446744073709551616", 20, &status));
+	ASSERT_EQUALS(I64_TOFROMSTR_FAIL_RANGE, status);
+	ASSERT_I64_EQUALS(i64_getZero(),
+		i64_fromUnsignedString(10, "-1", 2, &status));
+	ASSERT_EQUALS(I64_TOFROMSTR_FAIL_DIGIT, status);
+	printf("testToFromUnsignedString: all tests good\n");
+}
+
+/*
+	Test i64_parseBuffer and i64_parseStream on TEST_STRINGS,
+	joined by each of a few delimiters, and split across
+	buffers at every point.
+*/
+void testParseBuffer() {
+	static char text[ARRAY_LEN(TEST_STRINGS) * (I64_MAX_STRING_LENGTH + 1)];
+	static i64 out[ARRAY_LEN(TEST_STRINGS)];
+	const char *delims[] = { "\n", "\r\n", "," };
+	i64_parse_state state;
+	i64_parse_error err;
+	size_t len, count, split;
+	int d, i;
+	
+	#define CHECK_PARSED(count) \
+		ASSERT_EQUALS(ARRAY_LEN(TEST_STRINGS), count); \
+		for(i = 0; i < ARRAY_LEN(TEST_STRINGS); i++) { \
+			ASSERT_EQUALS(TEST_BITS[2 * i], i64_getHighBits(out[i])); \
+			ASSERT_EQUALS(TEST_BITS[2 * i + 1], i64_getLowBits(out[i])); \
+		}
+	
+	for(d = 0; d < ARRAY_LEN(delims); d++) {
+		printf("testParseBuffer: delimiter %d\n", d);
+		len = 0;
+		for(i = 0; i < ARRAY_LEN(TEST_STRINGS); i++) {
+			strcpy(text + len, TEST_STRINGS[i]);
+			len += strlen(TEST_STRINGS[i]);
+			/* no delimiter after the last field, unless by line */
+			if(i + 1 < ARRAY_LEN(TEST_STRINGS) || delims[d][0] != ',') {
+				strcpy(text + len, delims[d]);
+				len += strlen(delims[d]);
+			}
+		}
+		
+		count = i64_parseBuffer(text, len, delims[d][strlen(delims[d]) - 1],
+			out, ARRAY_LEN(out), &err);
+		CHECK_PARSED(count);
+		ASSERT_EQUALS(I64_TOFROMSTR_SUCC, err.status);
+		ASSERT_EQUALS(len, err.consumed);
+		
+		for(split = 0; split <= len; split++) {
+			i64_initParseState(&state);
+			count = i64_parseStream(&state, text, split,
+				delims[d][strlen(delims[d]) - 1], 0, out, ARRAY_LEN(out), &err);
+			ASSERT_EQUALS(I64_TOFROMSTR_SUCC, err.status);
+			ASSERT_EQUALS(split, err.consumed);
+			count += i64_parseStream(&state, text + split, len - split,
+				delims[d][strlen(delims[d]) - 1], 1, out + count,
+				ARRAY_LEN(out) - count, &err);
+			CHECK_PARSED(count);
+			ASSERT_EQUALS(len, err.offset);
+		}
+	}
+	
+	/* a malformed field, which we can then skip */
+	count = i64_parseBuffer("1,2,x3,4", 8, ',', out, ARRAY_LEN(out), &err);
+	ASSERT_EQUALS(2, count);
+	ASSERT_EQUALS(I64_TOFROMSTR_FAIL_DIGIT, err.status);
+	ASSERT_EQUALS(4, err.offset);
+	ASSERT_EQUALS(7, err.consumed);
+	count = i64_parseBuffer("1,2,x3,4" + err.consumed, 1, ',',
+		out, ARRAY_LEN(out), &err);
+	ASSERT_EQUALS(1, count);
+	ASSERT_I64_EQUALS(i64_fromInt(4), out[0]);
+	count = i64_parseBuffer("1,,2", 4, ',', out, ARRAY_LEN(out), &err);
+	ASSERT_EQUALS(1, count);
+	ASSERT_EQUALS(I64_TOFROMSTR_FAIL_DIGIT, err.status);
+	ASSERT_EQUALS(2, err.offset);
+	count = i64_parseBuffer("9223372036854775808\n", 20, '\n',
+		out, ARRAY_LEN(out), &err);
+	ASSERT_EQUALS(0, count);
+	ASSERT_EQUALS(I64_TOFROMSTR_FAIL_RANGE, err.status);
+	
+	/* long fields carried across buffers parse as in one buffer */
+	memset(text, '0', 100);
+	strcpy(text + 100, "42\r\n");
+	for(split = 0; split <= 104; split += 13) {
+		i64_initParseState(&state);
+		count = i64_parseStream(&state, text, split, '\n', 0,
+			out, ARRAY_LEN(out), &err);
+		count += i64_parseStream(&state, text + split, 104 - split, '\n', 1,
+			out + count, ARRAY_LEN(out) - count, &err);
+		ASSERT_EQUALS(1, count);
+		ASSERT_I64_EQUALS(i64_fromInt(42), out[0]);
+	}
+	memset(text, '1', 100);
+	text[99] = 'x';
+	for(split = 0; split <= 100; split += 20) {
+		i64_initParseState(&state);
+		count = i64_parseStream(&state, text, split, ',', 0,
+			out, ARRAY_LEN(out), &err);
+		i64_parseStream(&state, text + split, 100 - split, ',', 1,
+			out, ARRAY_LEN(out), &err);
+		ASSERT_EQUALS(I64_TOFROMSTR_FAIL_DIGIT, err.status);
+	}
+	text[99] = '1';
+	i64_initParseState(&state);
+	i64_parseStream(&state, text, 50, ',', 0, out, ARRAY_LEN(out), &err);
+	i64_parseStream(&state, text + 50, 50, ',', 1, out, ARRAY_LEN(out), &err);
+	ASSERT_EQUALS(I64_TOFROMSTR_FAIL_RANGE, err.status);
+	
+	/* running out of room, and resuming */
+	count = i64_parseBuffer("1,2,3", 5, ',', out, 2, &err);
+	ASSERT_EQUALS(2, count);
+	ASSERT_EQUALS(I64_TOFROMSTR_FAIL_LENGTH, err.status);
+	ASSERT_EQUALS(4, err.offset);
+	ASSERT_EQUALS(4, err.consumed);
+	
+	/* nothing at all */
+	ASSERT_EQUALS(0, i64_parseBuffer("", 0, ',', out, ARRAY_LEN(out), &err));
+	ASSERT_EQUALS(I64_TOFROMSTR_SUCC, err.status);
+	printf("testParseBuffer: all tests good\n");
+}
+
+/*
+	Test i64_formatArray against i64_toString, with room
+	for everything and then for a few bytes at a time.
+*/
+void testFormatArray() {
+	static char text[ARRAY_LEN(TEST_STRINGS) * (I64_MAX_STRING_LENGTH + 1)];
+	static char expected[ARRAY_LEN(TEST_STRINGS) * (I64_MAX_STRING_LENGTH + 1)];
+	static i64 vals[ARRAY_LEN(TEST_STRINGS)], parsed[ARRAY_LEN(TEST_STRINGS)];
+	i64_format_result result;
+	size_t len, written, done, cap;
+	int i;
+	
+	len = 0;
+	for(i = 0; i < ARRAY_LEN(TEST_STRINGS); i++) {
+		vals[i] = i64_fromBits(TEST_BITS[2 * i + 1], TEST_BITS[2 * i]);
+		ASSERT_EQUALS(strlen(TEST_STRINGS[i]), i64_decimalLength(vals[i]));
+		strcpy(expected + len, TEST_STRINGS[i]);
+		len += strlen(TEST_STRINGS[i]);
+		expected[len++] = '\n';
+	}
+	ASSERT_EQUALS(1, i64_decimalLength(i64_getZero()));
+	ASSERT_EQUALS(19, i64_decimalLength(i64_fromBits(0xA7640000, 0x0DE0B6B3)));
+		/* 10^18 */
+	ASSERT_EQUALS(18, i64_decimalLength(i64_fromBits(0xA763FFFF, 0x0DE0B6B3)));
+	
+	printf("testFormatArray: in one call\n");
+	result = i64_formatArray(vals, ARRAY_LEN(vals), '\n', text, sizeof text);
+	ASSERT_EQUALS(ARRAY_LEN(vals), result.count);
+	ASSERT_EQUALS(len, result.written);
+	ASSERT_EQUALS(0, memcmp(expected, text, len));
+	ASSERT_EQUALS(ARRAY_LEN(vals),
+		i64_parseBuffer(text, len, '\n', parsed, ARRAY_LEN(parsed), NULL));
+	for(i = 0; i < ARRAY_LEN(vals); i++) {
+		ASSERT_I64_EQUALS(vals[i], parsed[i]);
+	}
+	
+	for(cap = 3; cap <= 41; cap += 19) {
+		printf("testFormatArray: %d bytes at a time\n", (int)cap);
+		written = 0;
+		done = 0;
+		while(done < ARRAY_LEN(vals)) {
+			result = i64_formatArray(vals + done, ARRAY_LEN(vals) - done, '\n',
+				text + written, cap);
+			ASSERT_EQUALS(1, result.count > 0 || cap < 21);
+			if(result.count == 0) {
+				/* too long for this capacity; only so for short caps */
+				ASSERT_EQUALS(1,
+					i64_decimalLength(vals[done]) + 1 > (int)cap);
+				result = i64_formatArray(vals + done, 1, '\n',
+					text + written, I64_MAX_STRING_LENGTH);
+				ASSERT_EQUALS(1, result.count);
+			}
+			done += result.count;
+			written += result.written;
+		}
+		ASSERT_EQUALS(len, written);
+		ASSERT_EQUALS(0, memcmp(expected, text, len));
+	}
+	printf("testFormatArray: all tests good\n");
+}
+
 /*
 	Test i64_fromBits, and i64_get(High|Low)Bits
 	accessors
@@ -366,6 +1326,35 @@ void testToFromInt() {
 	printf("testToFromInt: all tests good\n");
 }
 
+/* A table built entirely at compile time. */
+static const i64 CONSTANT_TABLE[] = {
+	I64_C(0), I64_C(1), I64_C(-1), I64_C(-5), I64_C(0x7FFFFFFF),
+	I64_UC(0xFFFFFFFF), I64_INIT(0x80000000, 0), I64_INIT(0x7FFFFFFF, 0xFFFFFFFF),
+	I64_C(-0x80000000), I64_C(0xFFFFFFFF), I64_UC(0x80000000)
+};
+
+/* Test the constant initializers and constants */
+void testConstants() {
+	printf("testConstants\n");
+	ASSERT_I64_EQUALS(I64_ZERO, i64_fromBits(0, 0));
+	ASSERT_I64_EQUALS(I64_ONE, i64_fromBits(1, 0));
+	ASSERT_I64_EQUALS(I64_NEG_ONE, i64_fromBits(-1, -1));
+	ASSERT_I64_EQUALS(I64_MIN, i64_fromBits(0, 0x80000000));
+	ASSERT_I64_EQUALS(I64_MAX, i64_fromBits(0xFFFFFFFF, 0x7FFFFFFF));
+	ASSERT_I64_EQUALS(i64_getZero(), CONSTANT_TABLE[0]);
+	ASSERT_I64_EQUALS(i64_getOne(), CONSTANT_TABLE[1]);
+	ASSERT_I64_EQUALS(i64_getNegOne(), CONSTANT_TABLE[2]);
+	ASSERT_I64_EQUALS(i64_fromInt(-5), CONSTANT_TABLE[3]);
+	ASSERT_I64_EQUALS(i64_fromInt(0x7FFFFFFF), CONSTANT_TABLE[4]);
+	ASSERT_I64_EQUALS(i64_fromBits(0xFFFFFFFF, 0), CONSTANT_TABLE[5]);
+	ASSERT_I64_EQUALS(i64_getMinValue(), CONSTANT_TABLE[6]);
+	ASSERT_I64_EQUALS(i64_getMaxValue(), CONSTANT_TABLE[7]);
+	ASSERT_I64_EQUALS(i64_fromInt(-0x7FFFFFFF - 1), CONSTANT_TABLE[8]);
+	ASSERT_I64_EQUALS(i64_getNegOne(), CONSTANT_TABLE[9]);
+	ASSERT_I64_EQUALS(i64_fromBits(0x80000000, 0), CONSTANT_TABLE[10]);
+	printf("testConstants: all tests good\n");
+}
+
 /*
 	Test i64_(to|from)Double, recalling that
 	doubles are ES6 Numbers, and so we test
@@ -381,6 +1370,7 @@ void testToFromDouble() {
 	int i;
 	double num;
 	i64 val;
+	char str[I64_MAX_STRING_LENGTH + 1];
 	for(i = 0; i < ARRAY_LEN(TEST_BITS); i += 2) {
 		/* test a round-trip to and from doubles via i64. */
 		printf("testToFromDouble: test id %d\n", i);
@@ -390,25 +1380,97 @@ void testToFromDouble() {
 		ASSERT_EQUALS(0, fmod(num, 1));
 		printf("before roundtrip as double: %lf\n", num);
 		val = i64_fromDouble(num);
-		printf("after fromDouble: "); i64_debugPrintDecimal(val); printf("\n");
+		i64_toString(val, 10, str, sizeof str);
+		printf("after fromDouble: %s\n", str);
 		printf("after roundtrip: %lf\n", i64_toDouble(val));
 		ASSERT_EQUALS(num, i64_toDouble(val));
 	}
+	/* past 2^53, fractional parts, and out-of-range values */
+	ASSERT_I64_EQUALS(i64_shiftLeft(i64_getOne(), 62),
+		i64_fromDouble(TWO_PWR_62_DBL_));
+	ASSERT_I64_EQUALS(i64_fromBits(0xFFFFFC00, 0x7FFFFFFF),
+		i64_fromDouble(TWO_PWR_63_DBL_ - 1024));
+	ASSERT_I64_EQUALS(i64_getNegOne(), i64_fromDouble(-1.5));
+	ASSERT_I64_EQUALS(i64_getZero(), i64_fromDouble(0.75));
+	ASSERT_I64_EQUALS(i64_getMaxValue(), i64_fromDouble(TWO_PWR_63_DBL_));
+	ASSERT_I64_EQUALS(i64_getMinValue(), i64_fromDouble(-TWO_PWR_63_DBL_ * 2));
 	ASSERT_I64_EQUALS(i64_getZero(), i64_fromDouble(DBL_NAN));
 	ASSERT_I64_EQUALS(i64_getMaxValue(), i64_fromDouble(DBL_INF));
 	ASSERT_I64_EQUALS(i64_getMinValue(), i64_fromDouble(-DBL_INF));
+	
+	/* rounding to nearest, ties to even, past 2^53 */
+	ASSERT_EQUALS(9007199254740992.0,
+		i64_toDouble(i64_fromBits(1, 0x00200000))); /* 2^53 + 1 */
+	ASSERT_EQUALS(9007199254740996.0,
+		i64_toDouble(i64_fromBits(3, 0x00200000))); /* 2^53 + 3 */
+	ASSERT_EQUALS(-9007199254740992.0,
+		i64_toDouble(i64_negate(i64_fromBits(1, 0x00200000))));
+	ASSERT_EQUALS(18014398509481984.0,
+		i64_toDouble(i64_fromBits(2, 0x00400000))); /* 2^54 + 2 */
+	ASSERT_EQUALS(18014398509481992.0,
+		i64_toDouble(i64_fromBits(6, 0x00400000))); /* 2^54 + 6 */
+	ASSERT_EQUALS(18014398509481988.0,
+		i64_toDouble(i64_fromBits(5, 0x00400000))); /* 2^54 + 5 */
+	ASSERT_EQUALS(TWO_PWR_63_DBL_ - 1024,
+		i64_toDouble(i64_fromBits(0xFFFFFC00, 0x7FFFFFFF)));
+	ASSERT_EQUALS(TWO_PWR_63_DBL_,
+		i64_toDouble(i64_fromBits(0xFFFFFE00, 0x7FFFFFFF))); /* - 512 */
+	ASSERT_EQUALS(TWO_PWR_63_DBL_ - 2048,
+		i64_toDouble(i64_fromBits(0xFFFFFA00, 0x7FFFFFFF))); /* - 1536 */
+	ASSERT_EQUALS(TWO_PWR_63_DBL_, i64_toDouble(i64_getMaxValue()));
+	ASSERT_EQUALS(-TWO_PWR_63_DBL_, i64_toDouble(i64_getMinValue()));
 	printf("testToFromDouble: all tests good\n");
 }
 
 
+#ifdef I64_ENABLE_TRACE
+char traceBuffer[256];
+
+void captureTrace(const char *format, va_list args) {
+	size_t len = strlen(traceBuffer);
+	vsprintf(traceBuffer + len, format, args);
+}
+
+/* Test that traces reach an installed hook */
+void testTrace() {
+	printf("testTrace\n");
+	traceBuffer[0] = '\0';
+	i64_setTraceHook(captureTrace);
+	i64_debugPrint(i64_fromBits(1, 2));
+	ASSERT_EQUALS(0, strcmp(traceBuffer, "0x00000002 :: 0x00000001"));
+	traceBuffer[0] = '\0';
+	I64_TRACE(("%d:%s", 7, "x"));
+	ASSERT_EQUALS(0, strcmp(traceBuffer, "7:x"));
+	i64_setTraceHook(NULL);
+	
+	printf("testTrace: all tests good\n");
+}
+#endif
+
 int main(int argc, char **argv) {
+#ifdef I64_USE_NATIVE
+	printf("tests: using the native 64-bit backend\n");
+#elif defined(I64_USE_WORD_CARRY)
+	printf("tests: using the C89 backend, with word carries\n");
+#else
+	printf("tests: using the C89 backend\n");
+#endif
 	testComparisons();
 	testBitOperations();
-	/*testDivMod(); */
-	/*testToFromString();*/
-	/*testToFromUnsignedString(); */
+	testRotates();
+	testBitScans();
+	testDivMod();
+	testDivisor();
+#ifdef I64_ASSERT_HANDLER
+	testDivideByZero();
+#endif
+	testToFromString();
+	testToFromUnsignedString();
+	testParseBuffer();
+	testFormatArray();
 	testToFromBits();
 	testToFromInt();
+	testConstants();
 	testToFromDouble(); /* our equivalent of testToFromNumber */
 	/* testFromDecimalCachedValues not defined, since
 		caching functionality not needed */	
@@ -421,10 +1483,20 @@ int main(int argc, char **argv) {
 	testAdd();
 	testSubtract();
 	testMultiply();
+	testMultiplyFull();
+	testArrays();
+	testSoa();
+#ifdef I64_SIMD_X86
+	testSimd();
+#endif
+	testDispatch();
+#ifdef I64_ENABLE_TRACE
+	testTrace();
+#endif
 	
 	/* testIsStringInRange() */
-	/* testBase36ToString() */
-	/* testBaseDefaultFromString() */
+	/* testBase36ToString and testBaseDefaultFromString
+		are part of testToFromString */
 	/* testHashCode not defined, since Long.hashCode not implemented */
 	/* testIsSafeInteger(); needs from number */
 	
@@ -1259,145 +1259,820 @@ i32 TEST_MUL_BITS[] = {
 0x00000000, 0x00000001
 };
 
+/* Not in goog.math.Long -- computed by utility/generate_testcases.c:
+	the high 64 bits of the signed 128-bit products */
+i32 TEST_MULHI_BITS[] = {
+0x40000000, 0x00000000, 0x24449505, 0x54e58e92, 0x00080000, 0x00000000, 
+0x00080000, 0x00000000, 0x00008000, 0x00000000, 0x00008000, 0x00000000, 
+0x00000000, 0x80000000, 0x00000000, 0x80000000, 0x00000000, 0x00800000, 
+0x00000000, 0x00800000, 0x00000000, 0x00008000, 0x00000000, 0x00008000, 
+0x00000000, 0x00004000, 0x00000000, 0x00004000, 0x00000000, 0x00000001, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffc000, 0xffffffff, 0xffffc000, 
+0xffffffff, 0xffff8000, 0xffffffff, 0xffff8000, 0xffffffff, 0xff800000, 
+0xffffffff, 0xff800000, 0xffffffff, 0xd4e58e92, 0xffffffff, 0xa4449505, 
+0xffffffff, 0x80000000, 0xffffffff, 0x80000000, 0xffff8000, 0x00000000, 
+0xffff8000, 0x00000000, 0xfff80000, 0x00000000, 0xfff80000, 0x00000000, 
+0xd4e58e92, 0x24449505, 0xc0000000, 0x00000000, 0x24449505, 0x54e58e92, 
+0x148d7124, 0x05d37bf2, 0x00048892, 0xa0aa9cb2, 0x00048892, 0xa0aa9cb1, 
+0x00004889, 0x2a0aa9cb, 0x00004889, 0x2a0aa9cb, 0x00000000, 0x48892a0a, 
+0x00000000, 0x48892a0a, 0x00000000, 0x0048892a, 0x00000000, 0x0048892a, 
+0x00000000, 0x00004889, 0x00000000, 0x00004889, 0x00000000, 0x00002444, 
+0x00000000, 0x00002444, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffdbbb, 0xffffffff, 0xffffdbbb, 0xffffffff, 0xffffb777, 
+0xffffffff, 0xffffb776, 0xffffffff, 0xffb776d6, 0xffffffff, 0xffb776d5, 
+0xffffffff, 0xe792efbc, 0xffffffff, 0xcc044719, 0xffffffff, 0xb776d5f5, 
+0xffffffff, 0xb776d5f5, 0xffffb776, 0xd5f55635, 0xffffb776, 0xd5f55634, 
+0xfffb776d, 0x5f55634e, 0xfffb776d, 0x5f55634e, 0xe792efbc, 0x885b2d08, 
+0xdbbb6afa, 0xab1a716d, 0x00080000, 0x00000000, 0x00048892, 0xa0aa9cb2, 
+0x00000100, 0x00000000, 0x00000100, 0x00000000, 0x00000010, 0x00000000, 
+0x00000010, 0x00000000, 0x00000000, 0x00100000, 0x00000000, 0x00100000, 
+0x00000000, 0x00001000, 0x00000000, 0x00001000, 0x00000000, 0x00000010, 
+0x00000000, 0x00000010, 0x00000000, 0x00000008, 0x00000000, 0x00000008, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfffffff8, 
+0xffffffff, 0xfffffff7, 0xffffffff, 0xfffffff0, 0xffffffff, 0xffffffef, 
+0xffffffff, 0xfffff000, 0xffffffff, 0xffffefff, 0xffffffff, 0xfffa9cb1, 
+0xffffffff, 0xfff48892, 0xffffffff, 0xfff00000, 0xffffffff, 0xffefffff, 
+0xfffffff0, 0x00000000, 0xffffffef, 0xffffffff, 0xffffff00, 0x00000000, 
+0xfffffeff, 0xffffffff, 0xfffa9cb1, 0xd2448892, 0xfff7ffff, 0xffffffff, 
+0x00080000, 0x00000000, 0x00048892, 0xa0aa9cb1, 0x00000100, 0x00000000, 
+0x00000100, 0x00000000, 0x00000010, 0x00000000, 0x00000010, 0x00000000, 
+0x00000000, 0x00100000, 0x00000000, 0x00100000, 0x00000000, 0x00001000, 
+0x00000000, 0x00001000, 0x00000000, 0x00000010, 0x00000000, 0x00000010, 
+0x00000000, 0x00000008, 0x00000000, 0x00000008, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xfffffff8, 0xffffffff, 0xfffffff8, 
+0xffffffff, 0xfffffff0, 0xffffffff, 0xfffffff0, 0xffffffff, 0xfffff000, 
+0xffffffff, 0xfffff000, 0xffffffff, 0xfffa9cb1, 0xffffffff, 0xfff48892, 
+0xffffffff, 0xfff00000, 0xffffffff, 0xfff00000, 0xfffffff0, 0x00000000, 
+0xfffffff0, 0x00000000, 0xffffff00, 0x00000000, 0xffffff00, 0x00000000, 
+0xfffa9cb1, 0xd2448892, 0xfff80000, 0x00000000, 0x00008000, 0x00000000, 
+0x00004889, 0x2a0aa9cb, 0x00000010, 0x00000000, 0x00000010, 0x00000000, 
+0x00000001, 0x00000000, 0x00000001, 0x00000000, 0x00000000, 0x00010000, 
+0x00000000, 0x00010000, 0x00000000, 0x00000100, 0x00000000, 0x00000100, 
+0x00000000, 0x00000001, 0x00000000, 0x00000001, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xfffffffe, 0xffffffff, 0xffffff00, 0xffffffff, 0xfffffeff, 
+0xffffffff, 0xffffa9cb, 0xffffffff, 0xffff4889, 0xffffffff, 0xffff0000, 
+0xffffffff, 0xfffeffff, 0xffffffff, 0x00000000, 0xfffffffe, 0xffffffff, 
+0xffffffef, 0xffffffff, 0xffffffef, 0xffffffff, 0xffffa9cb, 0x1d244888, 
+0xffff7fff, 0xffffffff, 0x00008000, 0x00000000, 0x00004889, 0x2a0aa9cb, 
+0x00000010, 0x00000000, 0x00000010, 0x00000000, 0x00000001, 0x00000000, 
+0x00000001, 0x00000000, 0x00000000, 0x00010000, 0x00000000, 0x00010000, 
+0x00000000, 0x00000100, 0x00000000, 0x00000100, 0x00000000, 0x00000001, 
+0x00000000, 0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffff00, 0xffffffff, 0xffffff00, 0xffffffff, 0xffffa9cb, 
+0xffffffff, 0xffff4889, 0xffffffff, 0xffff0000, 0xffffffff, 0xffff0000, 
+0xffffffff, 0x00000000, 0xffffffff, 0x00000000, 0xfffffff0, 0x00000000, 
+0xfffffff0, 0x00000000, 0xffffa9cb, 0x1d244889, 0xffff8000, 0x00000000, 
+0x00000000, 0x80000000, 0x00000000, 0x48892a0a, 0x00000000, 0x00100000, 
+0x00000000, 0x00100000, 0x00000000, 0x00010000, 0x00000000, 0x00010000, 
+0x00000000, 0x00000001, 0x00000000, 0x00000001, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xfffffffe, 0xffffffff, 0xfffeffff, 
+0xffffffff, 0xfffeffff, 0xffffffff, 0xffefffff, 0xffffffff, 0xffefffff, 
+0xffffffff, 0xa9cb1d23, 0xffffffff, 0x7fffffff, 0x00000000, 0x80000000, 
+0x00000000, 0x48892a0a, 0x00000000, 0x00100000, 0x00000000, 0x00100000, 
+0x00000000, 0x00010000, 0x00000000, 0x00010000, 0x00000000, 0x00000001, 
+0x00000000, 0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffff0000, 0xffffffff, 0xffff0000, 
+0xffffffff, 0xfff00000, 0xffffffff, 0xfff00000, 0xffffffff, 0xa9cb1d24, 
+0xffffffff, 0x80000000, 0x00000000, 0x00800000, 0x00000000, 0x0048892a, 
+0x00000000, 0x00001000, 0x00000000, 0x00001000, 0x00000000, 0x00000100, 
+0x00000000, 0x00000100, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xfffffeff, 0xffffffff, 0xfffffeff, 0xffffffff, 0xffffefff, 
+0xffffffff, 0xffffefff, 0xffffffff, 0xffa9cb1c, 0xffffffff, 0xff7fffff, 
+0x00000000, 0x00800000, 0x00000000, 0x0048892a, 0x00000000, 0x00001000, 
+0x00000000, 0x00001000, 0x00000000, 0x00000100, 0x00000000, 0x00000100, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff00, 
+0xffffffff, 0xffffff00, 0xffffffff, 0xfffff000, 0xffffffff, 0xfffff000, 
+0xffffffff, 0xffa9cb1d, 0xffffffff, 0xff800000, 0x00000000, 0x00008000, 
+0x00000000, 0x00004889, 0x00000000, 0x00000010, 0x00000000, 0x00000010, 
+0x00000000, 0x00000001, 0x00000000, 0x00000001, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xfffffffe, 0xffffffff, 0xfffffffe, 
+0xffffffff, 0xffffffef, 0xffffffff, 0xffffffef, 0xffffffff, 0xffffa9ca, 
+0xffffffff, 0xffff7fff, 0x00000000, 0x00008000, 0x00000000, 0x00004889, 
+0x00000000, 0x00000010, 0x00000000, 0x00000010, 0x00000000, 0x00000001, 
+0x00000000, 0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfffffff0, 
+0xffffffff, 0xfffffff0, 0xffffffff, 0xffffa9cb, 0xffffffff, 0xffff8000, 
+0x00000000, 0x00004000, 0x00000000, 0x00002444, 0x00000000, 0x00000008, 
+0x00000000, 0x00000008, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xfffffff7, 0xffffffff, 0xfffffff7, 
+0xffffffff, 0xffffd4e5, 0xffffffff, 0xffffbfff, 0x00000000, 0x00004000, 
+0x00000000, 0x00002444, 0x00000000, 0x00000008, 0x00000000, 0x00000008, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xfffffff8, 0xffffffff, 0xfffffff8, 0xffffffff, 0xffffd4e5, 
+0xffffffff, 0xffffc000, 0x00000000, 0x00000001, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffffffff, 0xffffc000, 
+0xffffffff, 0xffffdbbb, 0xffffffff, 0xfffffff8, 0xffffffff, 0xfffffff8, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000007, 0x00000000, 0x00000007, 0x00000000, 0x00002b1a, 
+0x00000000, 0x00003fff, 0xffffffff, 0xffffc000, 0xffffffff, 0xffffdbbb, 
+0xffffffff, 0xfffffff7, 0xffffffff, 0xfffffff8, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000007, 
+0x00000000, 0x00000008, 0x00000000, 0x00002b1a, 0x00000000, 0x00003fff, 
+0xffffffff, 0xffff8000, 0xffffffff, 0xffffb777, 0xffffffff, 0xfffffff0, 
+0xffffffff, 0xfffffff0, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x00000000, 0x0000000f, 
+0x00000000, 0x00005634, 0x00000000, 0x00007fff, 0xffffffff, 0xffff8000, 
+0xffffffff, 0xffffb776, 0xffffffff, 0xffffffef, 0xffffffff, 0xfffffff0, 
+0xffffffff, 0xfffffffe, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000001, 
+0x00000000, 0x0000000f, 0x00000000, 0x00000010, 0x00000000, 0x00005634, 
+0x00000000, 0x00007fff, 0xffffffff, 0xff800000, 0xffffffff, 0xffb776d6, 
+0xffffffff, 0xfffff000, 0xffffffff, 0xfffff000, 0xffffffff, 0xffffff00, 
+0xffffffff, 0xffffff00, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x000000ff, 0x00000000, 0x000000ff, 0x00000000, 0x00000fff, 
+0x00000000, 0x00000fff, 0x00000000, 0x005634e2, 0x00000000, 0x007fffff, 
+0xffffffff, 0xff800000, 0xffffffff, 0xffb776d5, 0xffffffff, 0xffffefff, 
+0xffffffff, 0xfffff000, 0xffffffff, 0xfffffeff, 0xffffffff, 0xffffff00, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000000ff, 
+0x00000000, 0x00000100, 0x00000000, 0x00000fff, 0x00000000, 0x00001000, 
+0x00000000, 0x005634e2, 0x00000000, 0x007fffff, 0xffffffff, 0xd4e58e92, 
+0xffffffff, 0xe792efbc, 0xffffffff, 0xfffa9cb1, 0xffffffff, 0xfffa9cb1, 
+0xffffffff, 0xffffa9cb, 0xffffffff, 0xffffa9cb, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00005634, 0x00000000, 0x00005634, 
+0x00000000, 0x0005634e, 0x00000000, 0x0005634e, 0x00000000, 0x1d079358, 
+0x00000000, 0x2b1a716d, 0xffffffff, 0xa4449505, 0xffffffff, 0xcc044719, 
+0xffffffff, 0xfff48892, 0xffffffff, 0xfff48892, 0xffffffff, 0xffff4889, 
+0xffffffff, 0xffff4889, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x0000b776, 0x00000000, 0x0000b776, 0x00000000, 0x000b776d, 
+0x00000000, 0x000b776d, 0x00000000, 0x3dc7d298, 0x00000000, 0x5bbb6afa, 
+0xffffffff, 0x80000000, 0xffffffff, 0xb776d5f5, 0xffffffff, 0xfff00000, 
+0xffffffff, 0xfff00000, 0xffffffff, 0xffff0000, 0xffffffff, 0xffff0000, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000ffff, 
+0x00000000, 0x0000ffff, 0x00000000, 0x000fffff, 0x00000000, 0x000fffff, 
+0x00000000, 0x5634e2db, 0x00000000, 0x7fffffff, 0xffffffff, 0x80000000, 
+0xffffffff, 0xb776d5f5, 0xffffffff, 0xffefffff, 0xffffffff, 0xfff00000, 
+0xffffffff, 0xfffeffff, 0xffffffff, 0xffff0000, 0xffffffff, 0xfffffffe, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000001, 0x00000000, 0x0000ffff, 0x00000000, 0x00010000, 
+0x00000000, 0x000fffff, 0x00000000, 0x00100000, 0x00000000, 0x5634e2db, 
+0x00000000, 0x7fffffff, 0xffff8000, 0x00000000, 0xffffb776, 0xd5f55635, 
+0xfffffff0, 0x00000000, 0xfffffff0, 0x00000000, 0xffffffff, 0x00000000, 
+0xffffffff, 0x00000000, 0xffffffff, 0xfffeffff, 0xffffffff, 0xffff0000, 
+0xffffffff, 0xfffffeff, 0xffffffff, 0xffffff00, 0xffffffff, 0xfffffffe, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x000000ff, 0x00000000, 0x000000ff, 0x00000000, 0x00005634, 
+0x00000000, 0x0000b776, 0x00000000, 0x0000ffff, 0x00000000, 0x0000ffff, 
+0x00000000, 0xffffffff, 0x00000000, 0xffffffff, 0x0000000f, 0xffffffff, 
+0x0000000f, 0xffffffff, 0x00005634, 0xe2dbb776, 0x00007fff, 0xffffffff, 
+0xffff8000, 0x00000000, 0xffffb776, 0xd5f55634, 0xffffffef, 0xffffffff, 
+0xfffffff0, 0x00000000, 0xfffffffe, 0xffffffff, 0xffffffff, 0x00000000, 
+0xffffffff, 0xfffeffff, 0xffffffff, 0xffff0000, 0xffffffff, 0xfffffeff, 
+0xffffffff, 0xffffff00, 0xffffffff, 0xfffffffe, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00000000, 0x000000ff, 
+0x00000000, 0x00000100, 0x00000000, 0x00005634, 0x00000000, 0x0000b776, 
+0x00000000, 0x0000ffff, 0x00000000, 0x00010000, 0x00000000, 0xffffffff, 
+0x00000001, 0x00000000, 0x0000000f, 0xffffffff, 0x00000010, 0x00000000, 
+0x00005634, 0xe2dbb776, 0x00007fff, 0xffffffff, 0xfff80000, 0x00000000, 
+0xfffb776d, 0x5f55634e, 0xffffff00, 0x00000000, 0xffffff00, 0x00000000, 
+0xffffffef, 0xffffffff, 0xfffffff0, 0x00000000, 0xffffffff, 0xffefffff, 
+0xffffffff, 0xfff00000, 0xffffffff, 0xffffefff, 0xffffffff, 0xfffff000, 
+0xffffffff, 0xffffffef, 0xffffffff, 0xfffffff0, 0xffffffff, 0xfffffff7, 
+0xffffffff, 0xfffffff8, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000007, 0x00000000, 0x00000007, 0x00000000, 0x0000000f, 
+0x00000000, 0x0000000f, 0x00000000, 0x00000fff, 0x00000000, 0x00000fff, 
+0x00000000, 0x0005634e, 0x00000000, 0x000b776d, 0x00000000, 0x000fffff, 
+0x00000000, 0x000fffff, 0x0000000f, 0xffffffff, 0x0000000f, 0xffffffff, 
+0x000000ff, 0xffffffff, 0x000000ff, 0xffffffff, 0x0005634e, 0x2dbb776d, 
+0x0007ffff, 0xffffffff, 0xfff80000, 0x00000000, 0xfffb776d, 0x5f55634e, 
+0xfffffeff, 0xffffffff, 0xffffff00, 0x00000000, 0xffffffef, 0xffffffff, 
+0xfffffff0, 0x00000000, 0xffffffff, 0xffefffff, 0xffffffff, 0xfff00000, 
+0xffffffff, 0xffffefff, 0xffffffff, 0xfffff000, 0xffffffff, 0xffffffef, 
+0xffffffff, 0xfffffff0, 0xffffffff, 0xfffffff7, 0xffffffff, 0xfffffff8, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000007, 
+0x00000000, 0x00000008, 0x00000000, 0x0000000f, 0x00000000, 0x00000010, 
+0x00000000, 0x00000fff, 0x00000000, 0x00001000, 0x00000000, 0x0005634e, 
+0x00000000, 0x000b776d, 0x00000000, 0x000fffff, 0x00000000, 0x00100000, 
+0x0000000f, 0xffffffff, 0x00000010, 0x00000000, 0x000000ff, 0xffffffff, 
+0x00000100, 0x00000000, 0x0005634e, 0x2dbb776d, 0x0007ffff, 0xffffffff, 
+0xd4e58e92, 0x24449505, 0xe792efbc, 0x885b2d08, 0xfffa9cb1, 0xd2448892, 
+0xfffa9cb1, 0xd2448892, 0xffffa9cb, 0x1d244888, 0xffffa9cb, 0x1d244889, 
+0xffffffff, 0xa9cb1d23, 0xffffffff, 0xa9cb1d24, 0xffffffff, 0xffa9cb1c, 
+0xffffffff, 0xffa9cb1d, 0xffffffff, 0xffffa9ca, 0xffffffff, 0xffffa9cb, 
+0xffffffff, 0xffffd4e5, 0xffffffff, 0xffffd4e5, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00002b1a, 0x00000000, 0x00002b1a, 
+0x00000000, 0x00005634, 0x00000000, 0x00005634, 0x00000000, 0x005634e2, 
+0x00000000, 0x005634e2, 0x00000000, 0x1d079358, 0x00000000, 0x3dc7d298, 
+0x00000000, 0x5634e2db, 0x00000000, 0x5634e2db, 0x00005634, 0xe2dbb776, 
+0x00005634, 0xe2dbb776, 0x0005634e, 0x2dbb776d, 0x0005634e, 0x2dbb776d, 
+0x1d079358, 0x918f0c88, 0x2b1a716d, 0xdbbb6afa, 0xc0000000, 0x00000000, 
+0xdbbb6afa, 0xab1a716d, 0xfff7ffff, 0xffffffff, 0xfff80000, 0x00000000, 
+0xffff7fff, 0xffffffff, 0xffff8000, 0x00000000, 0xffffffff, 0x7fffffff, 
+0xffffffff, 0x80000000, 0xffffffff, 0xff7fffff, 0xffffffff, 0xff800000, 
+0xffffffff, 0xffff7fff, 0xffffffff, 0xffff8000, 0xffffffff, 0xffffbfff, 
+0xffffffff, 0xffffc000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00003fff, 0x00000000, 0x00003fff, 0x00000000, 0x00007fff, 
+0x00000000, 0x00007fff, 0x00000000, 0x007fffff, 0x00000000, 0x007fffff, 
+0x00000000, 0x2b1a716d, 0x00000000, 0x5bbb6afa, 0x00000000, 0x7fffffff, 
+0x00000000, 0x7fffffff, 0x00007fff, 0xffffffff, 0x00007fff, 0xffffffff, 
+0x0007ffff, 0xffffffff, 0x0007ffff, 0xffffffff, 0x2b1a716d, 0xdbbb6afa, 
+0x3fffffff, 0xffffffff,
+};
+
+/* Deviates from goog.long.Math -- these have been recomputed
+	(the original table is truncated) */
 i32 TEST_DIV_BITS[] = {
-  0x00000000, 0x00000001, 0x00000000, 0x00000001, 0x00000000, 0x000007ff,
-  0x00000000, 0x00000800, 0x00000000, 0x00007fff, 0x00000000, 0x00008000,
-  0x00000000, 0x7fffffff, 0x00000000, 0x80000000, 0x0000007f, 0xffff8000,
-  0x00000080, 0x00000000, 0x00007fff, 0x80007fff, 0x00008000, 0x00000000,
-  0x0000fffe, 0x0003fff8, 0x00010000, 0x00000000, 0x40000000, 0x00000000,
-  0x80000000, 0x00000000, 0x80000000, 0x00000000, 0xc0000000, 0x00000000,
-  0xfffefffd, 0xfffbfff8, 0xffff0000, 0x00000000, 0xffff7fff, 0x7fff8000,
-  0xffff8000, 0x00000000, 0xffffff7f, 0xffff8000, 0xffffff80, 0x00000000,
-  0xfffffffe, 0x83e3cc1a, 0xffffffff, 0x4d64985a, 0xffffffff, 0x80000000,
-  0xffffffff, 0x80000000, 0xffffffff, 0xffff8000, 0xffffffff, 0xffff8000,
-  0xffffffff, 0xfffff800, 0xffffffff, 0xfffff800, 0xffffffff, 0xffffffff,
-  0xffffffff, 0xffffffff, 0x00000000, 0x00000000, 0x00000000, 0x00000001,
-  0x00000000, 0x00000488, 0x00000000, 0x00000488, 0x00000000, 0x00004889,
-  0x00000000, 0x00004889, 0x00000000, 0x48892a0a, 0x00000000, 0x48892a0a,
-  0x00000048, 0x8929c220, 0x00000048, 0x892a0aa9, 0x00004888, 0xe181c849,
-  0x00004889, 0x2a0aa9cb, 0x00009111, 0x31f2efb0, 0x00009112, 0x54155396,
-  0x24449505, 0x54e58e92, 0x48892a0a, 0xa9cb1d25, 0xb776d5f5, 0x5634e2db,
-  0xdbbb6afa, 0xab1a716e, 0xffff6eec, 0x89c3bff2, 0xffff6eed, 0xabeaac6a,
-  0xffffb776, 0x8d6be3a1, 0xffffb776, 0xd5f55635, 0xffffffb7, 0x76d5acce,
-  0xffffffb7, 0x76d5f557, 0xffffffff, 0x2898cfc6, 0xffffffff, 0x9ac930b4,
-  0xffffffff, 0xb776d5f6, 0xffffffff, 0xb776d5f6, 0xffffffff, 0xffffb777,
-  0xffffffff, 0xffffb777, 0xffffffff, 0xfffffb78, 0xffffffff, 0xfffffb78,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00000000, 0x00000001,
-  0x00000000, 0x0000000f, 0x00000000, 0x00000010, 0x00000000, 0x000fffff,
-  0x00000000, 0x00100000, 0x00000000, 0x0ffffff0, 0x00000000, 0x10000000,
-  0x0000000f, 0xfff0000f, 0x00000010, 0x00000000, 0x0000001f, 0xffc0007f,
-  0x00000020, 0x00000000, 0x00080000, 0x00000000, 0x00100000, 0x00000001,
-  0xffefffff, 0xffffffff, 0xfff80000, 0x00000000, 0xffffffdf, 0xffbfff80,
-  0xffffffe0, 0x00000000, 0xffffffef, 0xffeffff0, 0xfffffff0, 0x00000000,
-  0xffffffff, 0xeffffff0, 0xffffffff, 0xf0000000, 0xffffffff, 0xffd07c7a,
-  0xffffffff, 0xffe9ac94, 0xffffffff, 0xfff00000, 0xffffffff, 0xfff00000,
-  0xffffffff, 0xfffffff0, 0xffffffff, 0xfffffff0, 0xffffffff, 0xffffffff,
-  0xffffffff, 0xffffffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000001, 0x00000000, 0x0000000f, 0x00000000, 0x00000010,
-  0x00000000, 0x000fffff, 0x00000000, 0x00100000, 0x00000000, 0x0ffffff0,
-  0x00000000, 0x10000000, 0x0000000f, 0xfff0000f, 0x00000010, 0x00000000,
-  0x0000001f, 0xffc0007f, 0x00000020, 0x00000000, 0x00080000, 0x00000000,
-  0x00100000, 0x00000000, 0xfff00000, 0x00000000, 0xfff80000, 0x00000000,
-  0xffffffdf, 0xffbfff80, 0xffffffe0, 0x00000000, 0xffffffef, 0xffeffff0,
-  0xfffffff0, 0x00000000, 0xffffffff, 0xeffffff0, 0xffffffff, 0xf0000000,
-  0xffffffff, 0xffd07c7a, 0xffffffff, 0xffe9ac94, 0xffffffff, 0xfff00000,
-  0xffffffff, 0xfff00000, 0xffffffff, 0xfffffff0, 0xffffffff, 0xfffffff0,
-  0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000001,
-  0x00000000, 0x00000001, 0x00000000, 0x0000ffff, 0x00000000, 0x00010000,
-  0x00000000, 0x00ffffff, 0x00000000, 0x01000000, 0x00000000, 0xffff0001,
-  0x00000001, 0x00000000, 0x00000001, 0xfffc0007, 0x00000002, 0x00000000,
-  0x00008000, 0x00000000, 0x00010000, 0x00000001, 0xfffeffff, 0xffffffff,
-  0xffff8000, 0x00000000, 0xfffffffd, 0xfffbfff8, 0xfffffffe, 0x00000000,
-  0xfffffffe, 0xfffeffff, 0xffffffff, 0x00000000, 0xffffffff, 0xfeffffff,
-  0xffffffff, 0xff000000, 0xffffffff, 0xfffd07c8, 0xffffffff, 0xfffe9aca,
-  0xffffffff, 0xffff0000, 0xffffffff, 0xffff0000, 0xffffffff, 0xffffffff,
-  0xffffffff, 0xffffffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00000000, 0x0000ffff,
-  0x00000000, 0x00010000, 0x00000000, 0x00ffffff, 0x00000000, 0x01000000,
-  0x00000000, 0xffff0000, 0x00000001, 0x00000000, 0x00000001, 0xfffc0007,
-  0x00000002, 0x00000000, 0x00008000, 0x00000000, 0x00010000, 0x00000000,
-  0xffff0000, 0x00000000, 0xffff8000, 0x00000000, 0xfffffffd, 0xfffbfff8,
-  0xfffffffe, 0x00000000, 0xfffffffe, 0xfffeffff, 0xffffffff, 0x00000000,
-  0xffffffff, 0xfeffffff, 0xffffffff, 0xff000000, 0xffffffff, 0xfffd07c8,
-  0xffffffff, 0xfffe9aca, 0xffffffff, 0xffff0000, 0xffffffff, 0xffff0000,
-  0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000001, 0x00000000, 0x00000001, 0x00000000, 0x000000ff,
-  0x00000000, 0x00000100, 0x00000000, 0x0000ffff, 0x00000000, 0x00010000,
-  0x00000000, 0x0001fffc, 0x00000000, 0x00020000, 0x00000000, 0x80000000,
-  0x00000001, 0x00000001, 0xfffffffe, 0xffffffff, 0xffffffff, 0x80000000,
-  0xffffffff, 0xfffdfffc, 0xffffffff, 0xfffe0000, 0xffffffff, 0xfffeffff,
-  0xffffffff, 0xffff0000, 0xffffffff, 0xffffff00, 0xffffffff, 0xffffff00,
-  0xffffffff, 0xfffffffe, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
-  0xffffffff, 0xffffffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000001,
-  0x00000000, 0x000000ff, 0x00000000, 0x00000100, 0x00000000, 0x0000ffff,
-  0x00000000, 0x00010000, 0x00000000, 0x0001fffc, 0x00000000, 0x00020000,
-  0x00000000, 0x80000000, 0x00000001, 0x00000000, 0xffffffff, 0x00000000,
-  0xffffffff, 0x80000000, 0xffffffff, 0xfffdfffc, 0xffffffff, 0xfffe0000,
-  0xffffffff, 0xfffeffff, 0xffffffff, 0xffff0000, 0xffffffff, 0xffffff00,
-  0xffffffff, 0xffffff00, 0xffffffff, 0xfffffffe, 0xffffffff, 0xffffffff,
-  0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00000000, 0x00000001,
-  0x00000000, 0x000000ff, 0x00000000, 0x00000100, 0x00000000, 0x000001ff,
-  0x00000000, 0x00000200, 0x00000000, 0x00800000, 0x00000000, 0x01000001,
-  0xffffffff, 0xfeffffff, 0xffffffff, 0xff800000, 0xffffffff, 0xfffffe00,
-  0xffffffff, 0xfffffe00, 0xffffffff, 0xffffff00, 0xffffffff, 0xffffff00,
-  0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000001, 0x00000000, 0x000000ff, 0x00000000, 0x00000100,
-  0x00000000, 0x000001ff, 0x00000000, 0x00000200, 0x00000000, 0x00800000,
-  0x00000000, 0x01000000, 0xffffffff, 0xff000000, 0xffffffff, 0xff800000,
-  0xffffffff, 0xfffffe00, 0xffffffff, 0xfffffe00, 0xffffffff, 0xffffff00,
-  0xffffffff, 0xffffff00, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000001,
-  0x00000000, 0x00000001, 0x00000000, 0x00000001, 0x00000000, 0x00000002,
-  0x00000000, 0x00008000, 0x00000000, 0x00010001, 0xffffffff, 0xfffeffff,
-  0xffffffff, 0xffff8000, 0xffffffff, 0xfffffffe, 0xffffffff, 0xfffffffe,
-  0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00000000, 0x00000001,
-  0x00000000, 0x00000002, 0x00000000, 0x00008000, 0x00000000, 0x00010000,
-  0xffffffff, 0xffff0000, 0xffffffff, 0xffff8000, 0xffffffff, 0xfffffffe,
-  0xffffffff, 0xfffffffe, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000000d
+0x00000000, 0x00000001, 0x00000000, 0x00000001, 0x00000000, 0x000007ff, 
+0x00000000, 0x00000800, 0x00000000, 0x00007fff, 0x00000000, 0x00008000, 
+0x00000000, 0x7fffffff, 0x00000000, 0x80000000, 0x0000007f, 0xffff8000, 
+0x00000080, 0x00000000, 0x00007fff, 0x80007fff, 0x00008000, 0x00000000, 
+0x0000fffe, 0x0003fff8, 0x00010000, 0x00000000, 0x40000000, 0x00000000, 
+0x80000000, 0x00000000, 0x80000000, 0x00000000, 0xc0000000, 0x00000000, 
+0xfffefffd, 0xfffbfff8, 0xffff0000, 0x00000000, 0xffff7fff, 0x7fff8000, 
+0xffff8000, 0x00000000, 0xffffff7f, 0xffff8000, 0xffffff80, 0x00000000, 
+0xfffffffe, 0x83e3cc1a, 0xffffffff, 0x4d64985a, 0xffffffff, 0x80000000, 
+0xffffffff, 0x80000000, 0xffffffff, 0xffff8000, 0xffffffff, 0xffff8000, 
+0xffffffff, 0xfffff800, 0xffffffff, 0xfffff800, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0x00000000, 0x00000000, 0x00000000, 0x00000001, 
+0x00000000, 0x00000488, 0x00000000, 0x00000488, 0x00000000, 0x00004889, 
+0x00000000, 0x00004889, 0x00000000, 0x48892a0a, 0x00000000, 0x48892a0a, 
+0x00000048, 0x8929c220, 0x00000048, 0x892a0aa9, 0x00004888, 0xe181c849, 
+0x00004889, 0x2a0aa9cb, 0x00009111, 0x31f2efb0, 0x00009112, 0x54155396, 
+0x24449505, 0x54e58e92, 0x48892a0a, 0xa9cb1d25, 0xb776d5f5, 0x5634e2db, 
+0xdbbb6afa, 0xab1a716e, 0xffff6eec, 0x89c3bff2, 0xffff6eed, 0xabeaac6a, 
+0xffffb776, 0x8d6be3a1, 0xffffb776, 0xd5f55635, 0xffffffb7, 0x76d5acce, 
+0xffffffb7, 0x76d5f557, 0xffffffff, 0x2898cfc6, 0xffffffff, 0x9ac930b4, 
+0xffffffff, 0xb776d5f6, 0xffffffff, 0xb776d5f6, 0xffffffff, 0xffffb777, 
+0xffffffff, 0xffffb777, 0xffffffff, 0xfffffb78, 0xffffffff, 0xfffffb78, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00000000, 0x00000001, 
+0x00000000, 0x0000000f, 0x00000000, 0x00000010, 0x00000000, 0x000fffff, 
+0x00000000, 0x00100000, 0x00000000, 0x0ffffff0, 0x00000000, 0x10000000, 
+0x0000000f, 0xfff0000f, 0x00000010, 0x00000000, 0x0000001f, 0xffc0007f, 
+0x00000020, 0x00000000, 0x00080000, 0x00000000, 0x00100000, 0x00000001, 
+0xffefffff, 0xffffffff, 0xfff80000, 0x00000000, 0xffffffdf, 0xffbfff80, 
+0xffffffe0, 0x00000000, 0xffffffef, 0xffeffff0, 0xfffffff0, 0x00000000, 
+0xffffffff, 0xeffffff0, 0xffffffff, 0xf0000000, 0xffffffff, 0xffd07c7a, 
+0xffffffff, 0xffe9ac94, 0xffffffff, 0xfff00000, 0xffffffff, 0xfff00000, 
+0xffffffff, 0xfffffff0, 0xffffffff, 0xfffffff0, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000001, 0x00000000, 0x0000000f, 0x00000000, 0x00000010, 
+0x00000000, 0x000fffff, 0x00000000, 0x00100000, 0x00000000, 0x0ffffff0, 
+0x00000000, 0x10000000, 0x0000000f, 0xfff0000f, 0x00000010, 0x00000000, 
+0x0000001f, 0xffc0007f, 0x00000020, 0x00000000, 0x00080000, 0x00000000, 
+0x00100000, 0x00000000, 0xfff00000, 0x00000000, 0xfff80000, 0x00000000, 
+0xffffffdf, 0xffbfff80, 0xffffffe0, 0x00000000, 0xffffffef, 0xffeffff0, 
+0xfffffff0, 0x00000000, 0xffffffff, 0xeffffff0, 0xffffffff, 0xf0000000, 
+0xffffffff, 0xffd07c7a, 0xffffffff, 0xffe9ac94, 0xffffffff, 0xfff00000, 
+0xffffffff, 0xfff00000, 0xffffffff, 0xfffffff0, 0xffffffff, 0xfffffff0, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000001, 
+0x00000000, 0x00000001, 0x00000000, 0x0000ffff, 0x00000000, 0x00010000, 
+0x00000000, 0x00ffffff, 0x00000000, 0x01000000, 0x00000000, 0xffff0001, 
+0x00000001, 0x00000000, 0x00000001, 0xfffc0007, 0x00000002, 0x00000000, 
+0x00008000, 0x00000000, 0x00010000, 0x00000001, 0xfffeffff, 0xffffffff, 
+0xffff8000, 0x00000000, 0xfffffffd, 0xfffbfff8, 0xfffffffe, 0x00000000, 
+0xfffffffe, 0xfffeffff, 0xffffffff, 0x00000000, 0xffffffff, 0xfeffffff, 
+0xffffffff, 0xff000000, 0xffffffff, 0xfffd07c8, 0xffffffff, 0xfffe9aca, 
+0xffffffff, 0xffff0000, 0xffffffff, 0xffff0000, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00000000, 0x0000ffff, 
+0x00000000, 0x00010000, 0x00000000, 0x00ffffff, 0x00000000, 0x01000000, 
+0x00000000, 0xffff0000, 0x00000001, 0x00000000, 0x00000001, 0xfffc0007, 
+0x00000002, 0x00000000, 0x00008000, 0x00000000, 0x00010000, 0x00000000, 
+0xffff0000, 0x00000000, 0xffff8000, 0x00000000, 0xfffffffd, 0xfffbfff8, 
+0xfffffffe, 0x00000000, 0xfffffffe, 0xfffeffff, 0xffffffff, 0x00000000, 
+0xffffffff, 0xfeffffff, 0xffffffff, 0xff000000, 0xffffffff, 0xfffd07c8, 
+0xffffffff, 0xfffe9aca, 0xffffffff, 0xffff0000, 0xffffffff, 0xffff0000, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000001, 0x00000000, 0x00000001, 0x00000000, 0x000000ff, 
+0x00000000, 0x00000100, 0x00000000, 0x0000ffff, 0x00000000, 0x00010000, 
+0x00000000, 0x0001fffc, 0x00000000, 0x00020000, 0x00000000, 0x80000000, 
+0x00000001, 0x00000001, 0xfffffffe, 0xffffffff, 0xffffffff, 0x80000000, 
+0xffffffff, 0xfffdfffc, 0xffffffff, 0xfffe0000, 0xffffffff, 0xfffeffff, 
+0xffffffff, 0xffff0000, 0xffffffff, 0xffffff00, 0xffffffff, 0xffffff00, 
+0xffffffff, 0xfffffffe, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000001, 
+0x00000000, 0x000000ff, 0x00000000, 0x00000100, 0x00000000, 0x0000ffff, 
+0x00000000, 0x00010000, 0x00000000, 0x0001fffc, 0x00000000, 0x00020000, 
+0x00000000, 0x80000000, 0x00000001, 0x00000000, 0xffffffff, 0x00000000, 
+0xffffffff, 0x80000000, 0xffffffff, 0xfffdfffc, 0xffffffff, 0xfffe0000, 
+0xffffffff, 0xfffeffff, 0xffffffff, 0xffff0000, 0xffffffff, 0xffffff00, 
+0xffffffff, 0xffffff00, 0xffffffff, 0xfffffffe, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00000000, 0x00000001, 
+0x00000000, 0x000000ff, 0x00000000, 0x00000100, 0x00000000, 0x000001ff, 
+0x00000000, 0x00000200, 0x00000000, 0x00800000, 0x00000000, 0x01000001, 
+0xffffffff, 0xfeffffff, 0xffffffff, 0xff800000, 0xffffffff, 0xfffffe00, 
+0xffffffff, 0xfffffe00, 0xffffffff, 0xffffff00, 0xffffffff, 0xffffff00, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000001, 0x00000000, 0x000000ff, 0x00000000, 0x00000100, 
+0x00000000, 0x000001ff, 0x00000000, 0x00000200, 0x00000000, 0x00800000, 
+0x00000000, 0x01000000, 0xffffffff, 0xff000000, 0xffffffff, 0xff800000, 
+0xffffffff, 0xfffffe00, 0xffffffff, 0xfffffe00, 0xffffffff, 0xffffff00, 
+0xffffffff, 0xffffff00, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000001, 
+0x00000000, 0x00000001, 0x00000000, 0x00000001, 0x00000000, 0x00000002, 
+0x00000000, 0x00008000, 0x00000000, 0x00010001, 0xffffffff, 0xfffeffff, 
+0xffffffff, 0xffff8000, 0xffffffff, 0xfffffffe, 0xffffffff, 0xfffffffe, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00000000, 0x00000001, 
+0x00000000, 0x00000002, 0x00000000, 0x00008000, 0x00000000, 0x00010000, 
+0xffffffff, 0xffff0000, 0xffffffff, 0xffff8000, 0xffffffff, 0xfffffffe, 
+0xffffffff, 0xfffffffe, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000001, 0x00000000, 0x00000001, 0x00000000, 0x00004000, 
+0x00000000, 0x00008001, 0xffffffff, 0xffff7fff, 0xffffffff, 0xffffc000, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000001, 
+0x00000000, 0x00004000, 0x00000000, 0x00008000, 0xffffffff, 0xffff8000, 
+0xffffffff, 0xffffc000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00000000, 0x00000002, 
+0xffffffff, 0xfffffffe, 0xffffffff, 0xffffffff, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000001, 0xffffffff, 0xffffffff, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffffffff, 0xffffffff, 
+0x00000000, 0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xfffffffe, 0x00000000, 0x00000002, 0x00000000, 0x00000001, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0xffffffff, 0xffffc001, 0xffffffff, 0xffff8001, 0x00000000, 0x00007fff, 
+0x00000000, 0x00003fff, 0x00000000, 0x00000001, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffc000, 0xffffffff, 0xffff8000, 
+0x00000000, 0x00008000, 0x00000000, 0x00004000, 0x00000000, 0x00000001, 
+0x00000000, 0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffff8001, 
+0xffffffff, 0xffff0001, 0x00000000, 0x0000ffff, 0x00000000, 0x00007fff, 
+0x00000000, 0x00000002, 0x00000000, 0x00000001, 0x00000000, 0x00000001, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfffffffe, 
+0xffffffff, 0xffff8000, 0xffffffff, 0xffff0000, 0x00000000, 0x00010000, 
+0x00000000, 0x00008000, 0x00000000, 0x00000002, 0x00000000, 0x00000002, 
+0x00000000, 0x00000001, 0x00000000, 0x00000001, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0xffffffff, 0xffffff01, 0xffffffff, 0xffffff01, 0xffffffff, 0xfffffe01, 
+0xffffffff, 0xfffffe01, 0xffffffff, 0xff800001, 0xffffffff, 0xff000001, 
+0x00000000, 0x00ffffff, 0x00000000, 0x007fffff, 0x00000000, 0x00000200, 
+0x00000000, 0x000001ff, 0x00000000, 0x00000100, 0x00000000, 0x000000ff, 
+0x00000000, 0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffff01, 0xffffffff, 0xffffff00, 
+0xffffffff, 0xfffffe01, 0xffffffff, 0xfffffe00, 0xffffffff, 0xff800000, 
+0xffffffff, 0xff000000, 0x00000000, 0x01000000, 0x00000000, 0x00800000, 
+0x00000000, 0x00000200, 0x00000000, 0x00000200, 0x00000000, 0x00000100, 
+0x00000000, 0x00000100, 0x00000000, 0x00000001, 0x00000000, 0x00000001, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0xffffffff, 0xffffffaa, 0xffffffff, 0xffffffaa, 0xffffffff, 0xffffa9cc, 
+0xffffffff, 0xffffa9cc, 0xffffffff, 0xffff5398, 0xffffffff, 0xffff5397, 
+0xffffffff, 0xd4e58e93, 0xffffffff, 0xa9cb1d25, 0x00000000, 0x5634e2db, 
+0x00000000, 0x2b1a716d, 0x00000000, 0x0000ac6b, 0x00000000, 0x0000ac69, 
+0x00000000, 0x00005635, 0x00000000, 0x00005634, 0x00000000, 0x00000056, 
+0x00000000, 0x00000056, 0x00000000, 0x00000001, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0xffffffff, 0xffffff49, 0xffffffff, 0xffffff49, 
+0xffffffff, 0xffff488a, 0xffffffff, 0xffff488a, 0xffffffff, 0xfffe9116, 
+0xffffffff, 0xfffe9113, 0xffffffff, 0xa4449506, 0xffffffff, 0x48892a0b, 
+0x00000000, 0xb776d5f5, 0x00000000, 0x5bbb6afa, 0x00000000, 0x00016ef0, 
+0x00000000, 0x00016eed, 0x00000000, 0x0000b777, 0x00000000, 0x0000b776, 
+0x00000000, 0x000000b7, 0x00000000, 0x000000b7, 0x00000000, 0x00000002, 
+0x00000000, 0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffffffff, 0xffffff01, 
+0xffffffff, 0xffffff01, 0xffffffff, 0xffff0001, 0xffffffff, 0xffff0001, 
+0xffffffff, 0xfffe0004, 0xffffffff, 0xfffe0001, 0xffffffff, 0x80000001, 
+0xffffffff, 0x00000001, 0x00000000, 0xffffffff, 0x00000000, 0x7fffffff, 
+0x00000000, 0x00020004, 0x00000000, 0x0001ffff, 0x00000000, 0x00010001, 
+0x00000000, 0x0000ffff, 0x00000000, 0x00000100, 0x00000000, 0x000000ff, 
+0x00000000, 0x00000002, 0x00000000, 0x00000001, 0x00000000, 0x00000001, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffffff01, 0xffffffff, 0xffffff00, 0xffffffff, 0xffff0001, 
+0xffffffff, 0xffff0000, 0xffffffff, 0xfffe0004, 0xffffffff, 0xfffe0000, 
+0xffffffff, 0x80000000, 0xffffffff, 0x00000000, 0x00000001, 0x00000000, 
+0x00000000, 0x80000000, 0x00000000, 0x00020004, 0x00000000, 0x00020000, 
+0x00000000, 0x00010001, 0x00000000, 0x00010000, 0x00000000, 0x00000100, 
+0x00000000, 0x00000100, 0x00000000, 0x00000002, 0x00000000, 0x00000001, 
+0x00000000, 0x00000001, 0x00000000, 0x00000001, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffffffff, 0xffff0001, 
+0xffffffff, 0xffff0001, 0xffffffff, 0xff000001, 0xffffffff, 0xff000001, 
+0xffffffff, 0x00010000, 0xffffffff, 0x00000001, 0xfffffffe, 0x0003fff9, 
+0xfffffffe, 0x00000001, 0xffff8000, 0x00000001, 0xffff0000, 0x00000001, 
+0x0000ffff, 0xffffffff, 0x00007fff, 0xffffffff, 0x00000002, 0x00040008, 
+0x00000001, 0xffffffff, 0x00000001, 0x00010001, 0x00000000, 0xffffffff, 
+0x00000000, 0x01000001, 0x00000000, 0x00ffffff, 0x00000000, 0x0002f838, 
+0x00000000, 0x00016536, 0x00000000, 0x00010000, 0x00000000, 0x0000ffff, 
+0x00000000, 0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xffff0001, 0xffffffff, 0xffff0000, 0xffffffff, 0xff000001, 
+0xffffffff, 0xff000000, 0xffffffff, 0x00010000, 0xffffffff, 0x00000000, 
+0xfffffffe, 0x0003fff9, 0xfffffffe, 0x00000000, 0xffff8000, 0x00000000, 
+0xffff0000, 0x00000000, 0x00010000, 0x00000000, 0x00008000, 0x00000000, 
+0x00000002, 0x00040008, 0x00000002, 0x00000000, 0x00000001, 0x00010001, 
+0x00000001, 0x00000000, 0x00000000, 0x01000001, 0x00000000, 0x01000000, 
+0x00000000, 0x0002f838, 0x00000000, 0x00016536, 0x00000000, 0x00010000, 
+0x00000000, 0x00010000, 0x00000000, 0x00000001, 0x00000000, 0x00000001, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffffffff, 0xfffffff1, 
+0xffffffff, 0xfffffff1, 0xffffffff, 0xfff00001, 0xffffffff, 0xfff00001, 
+0xffffffff, 0xf0000010, 0xffffffff, 0xf0000001, 0xfffffff0, 0x000ffff1, 
+0xfffffff0, 0x00000001, 0xffffffe0, 0x003fff81, 0xffffffe0, 0x00000001, 
+0xfff80000, 0x00000001, 0xfff00000, 0x00000001, 0x000fffff, 0xffffffff, 
+0x0007ffff, 0xffffffff, 0x00000020, 0x00400080, 0x0000001f, 0xffffffff, 
+0x00000010, 0x00100010, 0x0000000f, 0xffffffff, 0x00000000, 0x10000010, 
+0x00000000, 0x0fffffff, 0x00000000, 0x002f8386, 0x00000000, 0x0016536c, 
+0x00000000, 0x00100000, 0x00000000, 0x000fffff, 0x00000000, 0x00000010, 
+0x00000000, 0x0000000f, 0x00000000, 0x00000001, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xfffffff1, 0xffffffff, 0xfffffff0, 0xffffffff, 0xfff00001, 
+0xffffffff, 0xfff00000, 0xffffffff, 0xf0000010, 0xffffffff, 0xf0000000, 
+0xfffffff0, 0x000ffff1, 0xfffffff0, 0x00000000, 0xffffffe0, 0x003fff81, 
+0xffffffe0, 0x00000000, 0xfff80000, 0x00000000, 0xfff00000, 0x00000000, 
+0x00100000, 0x00000000, 0x00080000, 0x00000000, 0x00000020, 0x00400080, 
+0x00000020, 0x00000000, 0x00000010, 0x00100010, 0x00000010, 0x00000000, 
+0x00000000, 0x10000010, 0x00000000, 0x10000000, 0x00000000, 0x002f8386, 
+0x00000000, 0x0016536c, 0x00000000, 0x00100000, 0x00000000, 0x00100000, 
+0x00000000, 0x00000010, 0x00000000, 0x00000010, 0x00000000, 0x00000001, 
+0x00000000, 0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+0x00000000, 0x00000000, 0xffffffff, 0xffffffff, 0xffffffff, 0xfffffa9d, 
+0xffffffff, 0xfffffa9d, 0xffffffff, 0xffffa9cc, 0xffffffff, 0xffffa9cc, 
+0xffffffff, 0xa9cb1d25, 0xffffffff, 0xa9cb1d25, 0xffffffa9, 0xcb1d7a7e, 
+0xffffffa9, 0xcb1d2449, 0xffffa9cb, 0x7358d531, 0xffffa9cb, 0x1d24488a, 
+0xffff5397, 0x93196ae0, 0xffff5396, 0x3a489113, 0xd4e58e92, 0x24449506, 
+0xa9cb1d24, 0x48892a0b, 0x5634e2db, 0xb776d5f5, 0x2b1a716d, 0xdbbb6afa, 
+0x0000ac6b, 0x1e8dac09, 0x0000ac69, 0xc5b76eed, 0x00005635, 0x3910f087, 
+0x00005634, 0xe2dbb776, 0x00000056, 0x34e331ec, 0x00000056, 0x34e2dbb7, 
+0x00000001, 0x00000002, 0x00000000, 0x784a3552, 0x00000000, 0x5634e2dc, 
+0x00000000, 0x5634e2db, 0x00000000, 0x00005634, 0x00000000, 0x00005634, 
+0x00000000, 0x00000563, 0x00000000, 0x00000563, 0x00000000, 0x00000001, 
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffffffff, 0xffffffff, 
+0xffffffff, 0xfffff801, 0xffffffff, 0xfffff801, 0xffffffff, 0xffff8001, 
+0xffffffff, 0xffff8001, 0xffffffff, 0x80000001, 0xffffffff, 0x80000001, 
+0xffffff80, 0x00008000, 0xffffff80, 0x00000001, 0xffff8000, 0x7fff8001, 
+0xffff8000, 0x00000001, 0xffff0001, 0xfffc0008, 0xffff0000, 0x00000001, 
+0xc0000000, 0x00000001, 0x80000000, 0x00000001, 0x7fffffff, 0xffffffff, 
+0x3fffffff, 0xffffffff, 0x00010002, 0x00040008, 0x0000ffff, 0xffffffff, 
+0x00008000, 0x80008000, 0x00007fff, 0xffffffff, 0x00000080, 0x00008000, 
+0x0000007f, 0xffffffff, 0x00000001, 0x7c1c33e6, 0x00000000, 0xb29b67a6, 
+0x00000000, 0x80000000, 0x00000000, 0x7fffffff, 0x00000000, 0x00008000, 
+0x00000000, 0x00007fff, 0x00000000, 0x00000800, 0x00000000, 0x000007ff, 
+0x00000000, 0x00000001, 0x00000000, 0x00000001,
 };
 
 char *TEST_STRINGS[] = {
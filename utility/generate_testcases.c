@@ -23,6 +23,8 @@
 #define TEST_ADD 1
 #define TEST_MUL 2
 #define TEST_FROMDOUBLE 3
+#define TEST_DIV 4
+#define TEST_MULHIGH 5
 
 int parseArgs(int argc, char** argv) {
 	int arg1Len;
@@ -39,19 +41,46 @@ int parseArgs(int argc, char** argv) {
 		return TEST_ADD;
 	}
 	
+	if(0 == strncmp("mulhigh", argv[1], MIN(7, arg1Len))) {
+		return TEST_MULHIGH;
+	}
+	
 	if(0 == strncmp("multiply", argv[1], MIN(8, arg1Len))) {
 		return TEST_MUL;
 	}
 	
-		if(0 == strncmp("fromdouble", argv[1], MIN(10, arg1Len))) {
+	if(0 == strncmp("fromdouble", argv[1], MIN(10, arg1Len))) {
 		return TEST_FROMDOUBLE;
 	}
 	
+	if(0 == strncmp("divide", argv[1], MIN(6, arg1Len))) {
+		return TEST_DIV;
+	}
+	
 	/* at this point, invalid args: 2 arguments, but we
 		haven't recognized the second one */
 	return INVALID_ARGS;
 }
 
+/* The high 64 bits of the signed 128-bit product x * y. */
+int64_t mulHigh(int64_t x, int64_t y) {
+	uint64_t ux = x, uy = y;
+	uint64_t x0 = ux & 0xFFFFFFFF, x1 = ux >> 32;
+	uint64_t y0 = uy & 0xFFFFFFFF, y1 = uy >> 32;
+	uint64_t mid1 = x1 * y0 + ((x0 * y0) >> 32);
+	uint64_t mid2 = x0 * y1 + (mid1 & 0xFFFFFFFF);
+	uint64_t high = x1 * y1 + (mid1 >> 32) + (mid2 >> 32);
+	
+	/* correct the unsigned product for the signs. */
+	if(x < 0) {
+		high -= uy;
+	}
+	if(y < 0) {
+		high -= ux;
+	}
+	return high;
+}
+
 int main(int argc, char** argv) {
 	int i, j, pairsThisLine;
 	int64_t x, y, result;
@@ -63,7 +92,7 @@ int main(int argc, char** argv) {
 	int forTests = parseArgs(argc, argv);
 	
 	if(forTests == INVALID_ARGS) {
-		printf("help: generate_testcases (add | multiply | fromdouble)\n");
+		printf("help: generate_testcases (add | multiply | mulhigh | fromdouble | divide)\n");
 		return 1;
 	}
 	
@@ -75,6 +104,12 @@ int main(int argc, char** argv) {
 				+ (TEST_BITS[i + 1] & 0xFFFFFFFF);
 			y = (((uint64_t)(TEST_BITS[j])) << 32) 
 				+ (TEST_BITS[j + 1] & 0xFFFFFFFF);
+			
+			/* as in goog.math.Long's tests, division
+				skips zero divisors entirely. */
+			if(forTests == TEST_DIV && y == 0) {
+				continue;
+			}
 				
 			if(forTests == TEST_ADD) {
 				result = x + y;
@@ -82,6 +117,14 @@ int main(int argc, char** argv) {
 			else if(forTests == TEST_MUL) {
 				result = x * y;
 			}
+			else if(forTests == TEST_MULHIGH) {
+				result = mulHigh(x, y);
+			}
+			else if(forTests == TEST_DIV) {
+				/* (min value) / -1 overflows in C99; like
+					goog.math.Long, we wrap it back to min value. */
+				result = (y == -1) ? (int64_t)(0 - (uint64_t)x) : x / y;
+			}
 			/* fromDouble requires that
 				doubles have mantissa width less
 				than or equal to/than i64 (more 